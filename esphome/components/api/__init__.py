@@ -49,6 +49,8 @@ SERVICE_ARG_NATIVE_TYPES = {
     "string[]": cg.std_vector.template(cg.std_string),
 }
 CONF_ENCRYPTION = "encryption"
+CONF_MAX_CONNECTIONS = "max_connections"
+CONF_CACHE_LIST_ENTITIES = "cache_list_entities"
 
 
 def validate_encryption_key(value):
@@ -91,6 +93,8 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(
                 CONF_REBOOT_TIMEOUT, default="15min"
             ): cv.positive_time_period_milliseconds,
+            cv.Optional(CONF_MAX_CONNECTIONS, default=8): cv.int_range(min=1, max=32),
+            cv.Optional(CONF_CACHE_LIST_ENTITIES, default=False): cv.boolean,
             cv.Exclusive(
                 CONF_SERVICES, group_of_exclusion=CONF_ACTIONS
             ): ACTIONS_SCHEMA,
@@ -120,6 +124,8 @@ async def to_code(config):
     cg.add(var.set_port(config[CONF_PORT]))
     cg.add(var.set_password(config[CONF_PASSWORD]))
     cg.add(var.set_reboot_timeout(config[CONF_REBOOT_TIMEOUT]))
+    cg.add(var.set_max_connections(config[CONF_MAX_CONNECTIONS]))
+    cg.add(var.set_cache_list_entities(config[CONF_CACHE_LIST_ENTITIES]))
 
     for conf in config.get(CONF_ACTIONS, []):
         template_args = []
@@ -2,6 +2,7 @@
 #ifdef USE_API
 #include <cerrno>
 #include <cinttypes>
+#include <cmath>
 #include <utility>
 #include "esphome/components/network/util.h"
 #include "esphome/core/entity_base.h"
@@ -27,6 +28,12 @@ namespace api {
 
 static const char *const TAG = "api.connection";
 static const int ESP32_CAMERA_STOP_STREAM = 5000;
+// Bytes of incoming messages handled per connection and loop, so that a busy client can not starve the others
+static const size_t READ_BUDGET_PER_LOOP = 2048;
+// Budget charged for every message on top of its payload, to bound the number of small messages handled per loop
+static const size_t READ_COST_PER_MESSAGE = 64;
+// Entities sent per iterator and loop while a client is syncing, as long as the socket accepts them without blocking
+static const uint8_t ITERATOR_STEPS_PER_LOOP = 8;
 
 APIConnection::APIConnection(std::unique_ptr<socket::Socket> sock, APIServer *parent)
     : parent_(parent), initial_state_iterator_(this), list_entities_iterator_(this) {
@@ -56,6 +63,12 @@ void APIConnection::start() {
 }
 
 APIConnection::~APIConnection() {
+  auto *cache = this->parent_->get_list_entities_cache();
+  if (cache != nullptr && cache->recorder == this) {
+    // Disconnected half-way through the listing, let the next connection record it.
+    cache->clear();
+    cache->recorder = nullptr;
+  }
 #ifdef USE_BLUETOOTH_PROXY
   if (bluetooth_proxy::global_bluetooth_proxy->get_api_connection() == this) {
     bluetooth_proxy::global_bluetooth_proxy->unsubscribe_api_connection(this);
@@ -93,31 +106,60 @@ void APIConnection::loop() {
              api_error_to_str(err), errno);
     return;
   }
-  ReadPacketBuffer buffer;
-  err = this->helper_->read_packet(&buffer);
-  if (err == APIError::WOULD_BLOCK) {
-    // pass
-  } else if (err != APIError::OK) {
-    on_fatal_error();
-    if (err == APIError::SOCKET_READ_FAILED && errno == ECONNRESET) {
-      ESP_LOGW(TAG, "%s: Connection reset", this->client_combined_info_.c_str());
-    } else if (err == APIError::CONNECTION_CLOSED) {
-      ESP_LOGW(TAG, "%s: Connection closed", this->client_combined_info_.c_str());
-    } else {
-      ESP_LOGW(TAG, "%s: Reading failed: %s errno=%d", this->client_combined_info_.c_str(), api_error_to_str(err),
-               errno);
+  // Idle connections are skipped without a system call when the socket is monitored by the main loop
+  size_t budget = READ_BUDGET_PER_LOOP;
+  while (budget != 0 && this->helper_->is_socket_ready()) {
+    ReadPacketBuffer buffer;
+    err = this->helper_->read_packet(&buffer);
+    if (err == APIError::WOULD_BLOCK)
+      break;
+    if (err != APIError::OK) {
+      on_fatal_error();
+      if (err == APIError::SOCKET_READ_FAILED && errno == ECONNRESET) {
+        ESP_LOGW(TAG, "%s: Connection reset", this->client_combined_info_.c_str());
+      } else if (err == APIError::CONNECTION_CLOSED) {
+        ESP_LOGW(TAG, "%s: Connection closed", this->client_combined_info_.c_str());
+      } else {
+        ESP_LOGW(TAG, "%s: Reading failed: %s errno=%d", this->client_combined_info_.c_str(), api_error_to_str(err),
+                 errno);
+      }
+      return;
     }
-    return;
-  } else {
     this->last_traffic_ = millis();
     // read a packet
     this->read_message(buffer.data_len, buffer.type, &buffer.container[buffer.data_offset]);
     if (this->remove_)
       return;
+    budget -= std::min(budget, buffer.data_len + READ_COST_PER_MESSAGE);
   }
 
-  this->list_entities_iterator_.advance();
-  this->initial_state_iterator_.advance();
+  if (this->list_entities_cache_at_ != SIZE_MAX) {
+    this->send_cached_list_entities_();
+  } else {
+    for (uint8_t i = 0; i < ITERATOR_STEPS_PER_LOOP && !this->list_entities_iterator_.completed(); i++) {
+      this->recording_message_ = this->recording_list_entities_;
+      this->list_entities_iterator_.advance();
+      this->recording_message_ = false;
+      if (!this->helper_->can_write_without_blocking())
+        break;
+    }
+    if (this->recording_list_entities_ && this->list_entities_iterator_.completed()) {
+      auto *cache = this->parent_->get_list_entities_cache();
+      cache->complete = true;
+      cache->recorder = nullptr;
+      this->recording_list_entities_ = false;
+      ESP_LOGD(TAG, "Cached %zu entity info messages (%zu bytes)", cache->messages.size(), cache->data.size());
+    }
+  }
+  for (uint8_t i = 0; i < ITERATOR_STEPS_PER_LOOP && !this->initial_state_iterator_.completed(); i++) {
+    this->initial_state_iterator_.advance();
+    if (!this->helper_->can_write_without_blocking())
+      break;
+  }
+#ifdef USE_SENSOR
+  if (this->pending_sensor_states_ != 0)
+    this->send_pending_sensor_states_();
+#endif
 
   static uint32_t keepalive = 60000;
   static uint8_t max_ping_retries = 60;
@@ -459,11 +501,88 @@ bool APIConnection::send_sensor_state(sensor::Sensor *sensor, float state) {
   if (!this->state_subscription_)
     return false;
 
+  const uint32_t key = sensor->get_object_id_hash();
+  const uint32_t now = millis();
+  const SensorStateFilter *filter = this->get_sensor_state_filter_(key);
+  SensorStateSent *sent = nullptr;
+  if (filter != nullptr) {
+    auto it = this->sensor_states_sent_.find(key);
+    if (it != this->sensor_states_sent_.end()) {
+      sent = &it->second;
+      // A state becoming (un)available is always sent right away: NaN never compares within the deadband and
+      // such a transition is not held back by min_interval either
+      const bool availability_changed = std::isnan(state) != std::isnan(sent->state);
+      const float deadband = std::max(filter->absolute_deadband, filter->relative_deadband * std::fabs(sent->state));
+      if ((deadband > 0.0f && std::fabs(state - sent->state) <= deadband) ||
+          (std::isnan(state) && std::isnan(sent->state))) {
+        if (sent->pending) {
+          sent->pending = false;
+          this->pending_sensor_states_--;
+        }
+        return true;
+      }
+      if (!availability_changed && now - sent->time < filter->min_interval) {
+        if (!sent->pending) {
+          sent->pending = true;
+          this->pending_sensor_states_++;
+        }
+        return true;
+      }
+    }
+  }
+
   SensorStateResponse resp{};
-  resp.key = sensor->get_object_id_hash();
+  resp.key = key;
   resp.state = state;
   resp.missing_state = !sensor->has_state();
-  return this->send_sensor_state_response(resp);
+  if (!this->send_sensor_state_response(resp))
+    return false;
+  if (filter != nullptr) {
+    if (sent == nullptr) {
+      sent = &this->sensor_states_sent_[key];
+    } else if (sent->pending) {
+      this->pending_sensor_states_--;
+    }
+    *sent = SensorStateSent{sensor, state, now, false};
+  }
+  return true;
+}
+void APIConnection::sensor_state_filter(const SensorStateFilterRequest &msg) {
+  // Written as negations so that NaN is rejected too
+  if (!(msg.absolute_deadband >= 0.0f) || !(msg.relative_deadband >= 0.0f)) {
+    ESP_LOGW(TAG, "%s: Ignoring sensor state filter with negative deadband", this->client_combined_info_.c_str());
+    return;
+  }
+  const SensorStateFilter filter{msg.min_interval, msg.absolute_deadband, msg.relative_deadband};
+  if (msg.keys.empty()) {
+    this->default_sensor_state_filter_ = filter;
+    this->has_default_sensor_state_filter_ = true;
+  }
+  for (uint32_t key : msg.keys)
+    this->sensor_state_filters_[key] = filter;
+}
+const APIConnection::SensorStateFilter *APIConnection::get_sensor_state_filter_(uint32_t key) const {
+  auto it = this->sensor_state_filters_.find(key);
+  if (it != this->sensor_state_filters_.end())
+    return &it->second;
+  if (this->has_default_sensor_state_filter_)
+    return &this->default_sensor_state_filter_;
+  return nullptr;
+}
+void APIConnection::send_pending_sensor_states_() {
+  const uint32_t now = millis();
+  for (auto &it : this->sensor_states_sent_) {
+    const SensorStateSent &sent = it.second;
+    if (!sent.pending)
+      continue;
+    const SensorStateFilter *filter = this->get_sensor_state_filter_(it.first);
+    if (filter != nullptr && now - sent.time < filter->min_interval)
+      continue;
+    if (!this->helper_->can_write_without_blocking())
+      return;
+    // Sends the latest state, or drops the pending update if it went back into the deadband
+    this->send_sensor_state(sent.sensor, sent.sensor->state);
+  }
 }
 bool APIConnection::send_sensor_info(sensor::Sensor *sensor) {
   ListEntitiesSensorResponse msg;
@@ -1413,8 +1532,7 @@ bool APIConnection::send_log_message(int level, const char *tag, const char *lin
   buffer.encode_uint32(1, static_cast<uint32_t>(level));
   // string message = 3;
   buffer.encode_string(3, line, strlen(line));
-  // SubscribeLogsResponse - 29
-  return this->send_buffer(buffer, 29);
+  return this->send_buffer(buffer, SubscribeLogsResponse::MESSAGE_TYPE);
 }
 
 HelloResponse APIConnection::hello(const HelloRequest &msg) {
@@ -1429,7 +1547,7 @@ HelloResponse APIConnection::hello(const HelloRequest &msg) {
 
   HelloResponse resp;
   resp.api_version_major = 1;
-  resp.api_version_minor = 10;
+  resp.api_version_minor = 11;
   resp.server_info = App.get_name() + " (esphome v" ESPHOME_VERSION ")";
   resp.name = App.get_name();
 
@@ -1516,7 +1634,44 @@ void APIConnection::execute_service(const ExecuteServiceRequest &msg) {
 void APIConnection::subscribe_home_assistant_states(const SubscribeHomeAssistantStatesRequest &msg) {
   state_subs_at_ = 0;
 }
+void APIConnection::list_entities(const ListEntitiesRequest &msg) {
+  auto *cache = this->parent_->get_list_entities_cache();
+  if (cache != nullptr && cache->complete) {
+    this->list_entities_cache_at_ = 0;
+    return;
+  }
+  if (cache != nullptr && (cache->recorder == nullptr || cache->recorder == this)) {
+    cache->clear();
+    cache->recorder = this;
+    this->recording_list_entities_ = true;
+  }
+  this->list_entities_iterator_.begin();
+}
+
+void APIConnection::send_cached_list_entities_() {
+  const auto &cache = *this->parent_->get_list_entities_cache();
+  for (uint8_t i = 0; i < ITERATOR_STEPS_PER_LOOP && this->list_entities_cache_at_ < cache.messages.size(); i++) {
+    const auto &message = cache.messages[this->list_entities_cache_at_];
+    if (!this->send_encoded_(message.type, cache.data.data() + message.offset, message.length))
+      return;
+    this->list_entities_cache_at_++;
+  }
+  if (this->list_entities_cache_at_ == cache.messages.size())
+    this->list_entities_cache_at_ = SIZE_MAX;
+}
+
 bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) {
+  const auto *data = buffer.get_buffer()->data();
+  const size_t len = buffer.get_buffer()->size();
+  if (!this->send_encoded_(message_type, data, len))
+    return false;
+  // SubscribeLogsResponse can be sent from within the iterator, everything else it sends is entity info
+  if (this->recording_message_ && message_type != SubscribeLogsResponse::MESSAGE_TYPE)
+    this->parent_->get_list_entities_cache()->add(message_type, data, len);
+  return true;
+}
+
+bool APIConnection::send_encoded_(uint32_t message_type, const uint8_t *data, size_t len) {
   if (this->remove_)
     return false;
   if (!this->helper_->can_write_without_blocking()) {
@@ -1529,8 +1684,7 @@ bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type)
       return false;
     }
     if (!this->helper_->can_write_without_blocking()) {
-      // SubscribeLogsResponse
-      if (message_type != 29) {
+      if (message_type != SubscribeLogsResponse::MESSAGE_TYPE) {
         ESP_LOGV(TAG, "Cannot send message because of TCP buffer space");
       }
       delay(0);
@@ -1538,7 +1692,7 @@ bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type)
     }
   }
 
-  APIError err = this->helper_->write_packet(message_type, buffer.get_buffer()->data(), buffer.get_buffer()->size());
+  APIError err = this->helper_->write_packet(message_type, data, len);
   if (err == APIError::WOULD_BLOCK)
     return false;
   if (err != APIError::OK) {
@@ -9,6 +9,7 @@
 #include "esphome/core/application.h"
 #include "esphome/core/component.h"
 
+#include <map>
 #include <vector>
 
 namespace esphome {
@@ -48,6 +49,7 @@ class APIConnection : public APIServerConnection {
 #ifdef USE_SENSOR
   bool send_sensor_state(sensor::Sensor *sensor, float state);
   bool send_sensor_info(sensor::Sensor *sensor);
+  void sensor_state_filter(const SensorStateFilterRequest &msg) override;
 #endif
 #ifdef USE_SWITCH
   bool send_switch_state(switch_::Switch *a_switch, bool state);
@@ -190,7 +192,7 @@ class APIConnection : public APIServerConnection {
   DisconnectResponse disconnect(const DisconnectRequest &msg) override;
   PingResponse ping(const PingRequest &msg) override { return {}; }
   DeviceInfoResponse device_info(const DeviceInfoRequest &msg) override;
-  void list_entities(const ListEntitiesRequest &msg) override { this->list_entities_iterator_.begin(); }
+  void list_entities(const ListEntitiesRequest &msg) override;
   void subscribe_states(const SubscribeStatesRequest &msg) override {
     this->state_subscription_ = true;
     this->initial_state_iterator_.begin();
@@ -230,6 +232,14 @@ class APIConnection : public APIServerConnection {
   friend APIServer;
 
   bool send_(const void *buf, size_t len, bool force);
+  /// Send an already encoded message.
+  bool send_encoded_(uint32_t message_type, const uint8_t *data, size_t len);
+  /// Replay entity info messages from the server's cache, see ListEntitiesCache.
+  void send_cached_list_entities_();
+#ifdef USE_SENSOR
+  /// Send the latest state of every sensor whose update was held back by its minimum interval.
+  void send_pending_sensor_states_();
+#endif
 
   enum class ConnectionState {
     WAITING_FOR_HELLO,
@@ -264,7 +274,36 @@ class APIConnection : public APIServerConnection {
   APIServer *parent_;
   InitialStateIterator initial_state_iterator_;
   ListEntitiesIterator list_entities_iterator_;
+  /// Next message to replay from the list entities cache, SIZE_MAX if not replaying.
+  size_t list_entities_cache_at_{SIZE_MAX};
+  /// Whether the messages sent by list_entities_iterator_ are recorded into the list entities cache.
+  bool recording_list_entities_{false};
+  /// Set while list_entities_iterator_ advances and its messages are being recorded.
+  bool recording_message_{false};
   int state_subs_at_ = -1;
+#ifdef USE_SENSOR
+  struct SensorStateFilter {
+    uint32_t min_interval;
+    float absolute_deadband;
+    float relative_deadband;
+  };
+  struct SensorStateSent {
+    sensor::Sensor *sensor;
+    float state;
+    uint32_t time;
+    /// A state change arrived within min_interval of the last send and still has to be sent.
+    bool pending;
+  };
+  const SensorStateFilter *get_sensor_state_filter_(uint32_t key) const;
+
+  /// Filter for sensors without their own entry in sensor_state_filters_, requested with an empty key list.
+  SensorStateFilter default_sensor_state_filter_{};
+  bool has_default_sensor_state_filter_{false};
+  std::map<uint32_t, SensorStateFilter> sensor_state_filters_;
+  /// Last state sent per sensor key, only tracked for sensors with a filter.
+  std::map<uint32_t, SensorStateSent> sensor_states_sent_;
+  size_t pending_sensor_states_{0};
+#endif
 };
 
 }  // namespace api
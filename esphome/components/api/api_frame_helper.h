@@ -64,6 +64,8 @@ class APIFrameHelper {
   virtual APIError init() = 0;
   virtual APIError loop() = 0;
   virtual APIError read_packet(ReadPacketBuffer *buffer) = 0;
+  /// Whether the underlying socket may have data to read, see socket::Socket::ready().
+  virtual bool is_socket_ready() const = 0;
   virtual bool can_write_without_blocking() = 0;
   virtual APIError write_packet(uint16_t type, const uint8_t *data, size_t len) = 0;
   virtual std::string getpeername() = 0;
@@ -83,6 +85,7 @@ class APINoiseFrameHelper : public APIFrameHelper {
   APIError init() override;
   APIError loop() override;
   APIError read_packet(ReadPacketBuffer *buffer) override;
+  bool is_socket_ready() const override { return this->socket_ != nullptr && this->socket_->ready(); }
   bool can_write_without_blocking() override;
   APIError write_packet(uint16_t type, const uint8_t *payload, size_t len) override;
   std::string getpeername() override { return this->socket_->getpeername(); }
@@ -146,6 +149,7 @@ class APIPlaintextFrameHelper : public APIFrameHelper {
   APIError init() override;
   APIError loop() override;
   APIError read_packet(ReadPacketBuffer *buffer) override;
+  bool is_socket_ready() const override { return this->socket_ != nullptr && this->socket_->ready(); }
   bool can_write_without_blocking() override;
   APIError write_packet(uint16_t type, const uint8_t *payload, size_t len) override;
   std::string getpeername() override { return this->socket_->getpeername(); }
@@ -2582,6 +2582,70 @@ void SensorStateResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 #endif
+bool SensorStateFilterRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
+  switch (field_id) {
+    case 2: {
+      this->min_interval = value.as_uint32();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+bool SensorStateFilterRequest::decode_32bit(uint32_t field_id, Proto32Bit value) {
+  switch (field_id) {
+    case 1: {
+      this->keys.push_back(value.as_fixed32());
+      return true;
+    }
+    case 3: {
+      this->absolute_deadband = value.as_float();
+      return true;
+    }
+    case 4: {
+      this->relative_deadband = value.as_float();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+void SensorStateFilterRequest::encode(ProtoWriteBuffer buffer) const {
+  for (auto &it : this->keys) {
+    buffer.encode_fixed32(1, it, true);
+  }
+  buffer.encode_uint32(2, this->min_interval);
+  buffer.encode_float(3, this->absolute_deadband);
+  buffer.encode_float(4, this->relative_deadband);
+}
+#ifdef HAS_PROTO_MESSAGE_DUMP
+void SensorStateFilterRequest::dump_to(std::string &out) const {
+  __attribute__((unused)) char buffer[64];
+  out.append("SensorStateFilterRequest {\n");
+  for (const auto &it : this->keys) {
+    out.append("  keys: ");
+    sprintf(buffer, "%" PRIu32, it);
+    out.append(buffer);
+    out.append("\n");
+  }
+
+  out.append("  min_interval: ");
+  sprintf(buffer, "%" PRIu32, this->min_interval);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  absolute_deadband: ");
+  sprintf(buffer, "%g", this->absolute_deadband);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  relative_deadband: ");
+  sprintf(buffer, "%g", this->relative_deadband);
+  out.append(buffer);
+  out.append("\n");
+  out.append("}");
+}
+#endif
 bool ListEntitiesSwitchResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
     case 6: {
@@ -241,6 +241,7 @@ enum UpdateCommand : uint32_t {
 
 class HelloRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 1;
   std::string client_info{};
   uint32_t api_version_major{0};
   uint32_t api_version_minor{0};
@@ -255,6 +256,7 @@ class HelloRequest : public ProtoMessage {
 };
 class HelloResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 2;
   uint32_t api_version_major{0};
   uint32_t api_version_minor{0};
   std::string server_info{};
@@ -270,6 +272,7 @@ class HelloResponse : public ProtoMessage {
 };
 class ConnectRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 3;
   std::string password{};
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
@@ -281,6 +284,7 @@ class ConnectRequest : public ProtoMessage {
 };
 class ConnectResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 4;
   bool invalid_password{false};
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
@@ -292,6 +296,7 @@ class ConnectResponse : public ProtoMessage {
 };
 class DisconnectRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 5;
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
@@ -301,6 +306,7 @@ class DisconnectRequest : public ProtoMessage {
 };
 class DisconnectResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 6;
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
@@ -310,6 +316,7 @@ class DisconnectResponse : public ProtoMessage {
 };
 class PingRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 7;
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
@@ -319,6 +326,7 @@ class PingRequest : public ProtoMessage {
 };
 class PingResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 8;
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
@@ -328,6 +336,7 @@ class PingResponse : public ProtoMessage {
 };
 class DeviceInfoRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 9;
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
@@ -337,6 +346,7 @@ class DeviceInfoRequest : public ProtoMessage {
 };
 class DeviceInfoResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 10;
   bool uses_password{false};
   std::string name{};
   std::string mac_address{};
@@ -365,6 +375,7 @@ class DeviceInfoResponse : public ProtoMessage {
 };
 class ListEntitiesRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 11;
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
@@ -374,6 +385,7 @@ class ListEntitiesRequest : public ProtoMessage {
 };
 class ListEntitiesDoneResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 19;
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
@@ -383,6 +395,7 @@ class ListEntitiesDoneResponse : public ProtoMessage {
 };
 class SubscribeStatesRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 20;
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
@@ -392,6 +405,7 @@ class SubscribeStatesRequest : public ProtoMessage {
 };
 class ListEntitiesBinarySensorResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 12;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -413,6 +427,7 @@ class ListEntitiesBinarySensorResponse : public ProtoMessage {
 };
 class BinarySensorStateResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 21;
   uint32_t key{0};
   bool state{false};
   bool missing_state{false};
@@ -427,6 +442,7 @@ class BinarySensorStateResponse : public ProtoMessage {
 };
 class ListEntitiesCoverResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 13;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -451,6 +467,7 @@ class ListEntitiesCoverResponse : public ProtoMessage {
 };
 class CoverStateResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 22;
   uint32_t key{0};
   enums::LegacyCoverState legacy_state{};
   float position{0.0f};
@@ -467,6 +484,7 @@ class CoverStateResponse : public ProtoMessage {
 };
 class CoverCommandRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 30;
   uint32_t key{0};
   bool has_legacy_command{false};
   enums::LegacyCoverCommand legacy_command{};
@@ -486,6 +504,7 @@ class CoverCommandRequest : public ProtoMessage {
 };
 class ListEntitiesFanResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 14;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -510,6 +529,7 @@ class ListEntitiesFanResponse : public ProtoMessage {
 };
 class FanStateResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 23;
   uint32_t key{0};
   bool state{false};
   bool oscillating{false};
@@ -529,6 +549,7 @@ class FanStateResponse : public ProtoMessage {
 };
 class FanCommandRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 31;
   uint32_t key{0};
   bool has_state{false};
   bool state{false};
@@ -554,6 +575,7 @@ class FanCommandRequest : public ProtoMessage {
 };
 class ListEntitiesLightResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 15;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -581,6 +603,7 @@ class ListEntitiesLightResponse : public ProtoMessage {
 };
 class LightStateResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 24;
   uint32_t key{0};
   bool state{false};
   float brightness{0.0f};
@@ -606,6 +629,7 @@ class LightStateResponse : public ProtoMessage {
 };
 class LightCommandRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 32;
   uint32_t key{0};
   bool has_state{false};
   bool state{false};
@@ -645,6 +669,7 @@ class LightCommandRequest : public ProtoMessage {
 };
 class ListEntitiesSensorResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 16;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -670,6 +695,7 @@ class ListEntitiesSensorResponse : public ProtoMessage {
 };
 class SensorStateResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 25;
   uint32_t key{0};
   float state{0.0f};
   bool missing_state{false};
@@ -682,8 +708,25 @@ class SensorStateResponse : public ProtoMessage {
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
+class SensorStateFilterRequest : public ProtoMessage {
+ public:
+  static constexpr uint16_t MESSAGE_TYPE = 124;
+  std::vector<uint32_t> keys{};
+  uint32_t min_interval{0};
+  float absolute_deadband{0.0f};
+  float relative_deadband{0.0f};
+  void encode(ProtoWriteBuffer buffer) const override;
+#ifdef HAS_PROTO_MESSAGE_DUMP
+  void dump_to(std::string &out) const override;
+#endif
+
+ protected:
+  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
+  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+};
 class ListEntitiesSwitchResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 17;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -705,6 +748,7 @@ class ListEntitiesSwitchResponse : public ProtoMessage {
 };
 class SwitchStateResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 26;
   uint32_t key{0};
   bool state{false};
   void encode(ProtoWriteBuffer buffer) const override;
@@ -718,6 +762,7 @@ class SwitchStateResponse : public ProtoMessage {
 };
 class SwitchCommandRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 33;
   uint32_t key{0};
   bool state{false};
   void encode(ProtoWriteBuffer buffer) const override;
@@ -731,6 +776,7 @@ class SwitchCommandRequest : public ProtoMessage {
 };
 class ListEntitiesTextSensorResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 18;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -751,6 +797,7 @@ class ListEntitiesTextSensorResponse : public ProtoMessage {
 };
 class TextSensorStateResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 27;
   uint32_t key{0};
   std::string state{};
   bool missing_state{false};
@@ -766,6 +813,7 @@ class TextSensorStateResponse : public ProtoMessage {
 };
 class SubscribeLogsRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 28;
   enums::LogLevel level{};
   bool dump_config{false};
   void encode(ProtoWriteBuffer buffer) const override;
@@ -778,6 +826,7 @@ class SubscribeLogsRequest : public ProtoMessage {
 };
 class SubscribeLogsResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 29;
   enums::LogLevel level{};
   std::string message{};
   bool send_failed{false};
@@ -792,6 +841,7 @@ class SubscribeLogsResponse : public ProtoMessage {
 };
 class SubscribeHomeassistantServicesRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 34;
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
@@ -813,6 +863,7 @@ class HomeassistantServiceMap : public ProtoMessage {
 };
 class HomeassistantServiceResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 35;
   std::string service{};
   std::vector<HomeassistantServiceMap> data{};
   std::vector<HomeassistantServiceMap> data_template{};
@@ -829,6 +880,7 @@ class HomeassistantServiceResponse : public ProtoMessage {
 };
 class SubscribeHomeAssistantStatesRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 38;
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
@@ -838,6 +890,7 @@ class SubscribeHomeAssistantStatesRequest : public ProtoMessage {
 };
 class SubscribeHomeAssistantStateResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 39;
   std::string entity_id{};
   std::string attribute{};
   bool once{false};
@@ -852,6 +905,7 @@ class SubscribeHomeAssistantStateResponse : public ProtoMessage {
 };
 class HomeAssistantStateResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 40;
   std::string entity_id{};
   std::string state{};
   std::string attribute{};
@@ -865,6 +919,7 @@ class HomeAssistantStateResponse : public ProtoMessage {
 };
 class GetTimeRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 36;
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
@@ -874,6 +929,7 @@ class GetTimeRequest : public ProtoMessage {
 };
 class GetTimeResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 37;
   uint32_t epoch_seconds{0};
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
@@ -898,6 +954,7 @@ class ListEntitiesServicesArgument : public ProtoMessage {
 };
 class ListEntitiesServicesResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 41;
   std::string name{};
   uint32_t key{0};
   std::vector<ListEntitiesServicesArgument> args{};
@@ -933,6 +990,7 @@ class ExecuteServiceArgument : public ProtoMessage {
 };
 class ExecuteServiceRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 42;
   uint32_t key{0};
   std::vector<ExecuteServiceArgument> args{};
   void encode(ProtoWriteBuffer buffer) const override;
@@ -946,6 +1004,7 @@ class ExecuteServiceRequest : public ProtoMessage {
 };
 class ListEntitiesCameraResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 43;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -965,6 +1024,7 @@ class ListEntitiesCameraResponse : public ProtoMessage {
 };
 class CameraImageResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 44;
   uint32_t key{0};
   std::string data{};
   bool done{false};
@@ -980,6 +1040,7 @@ class CameraImageResponse : public ProtoMessage {
 };
 class CameraImageRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 45;
   bool single{false};
   bool stream{false};
   void encode(ProtoWriteBuffer buffer) const override;
@@ -992,6 +1053,7 @@ class CameraImageRequest : public ProtoMessage {
 };
 class ListEntitiesClimateResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 46;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -1029,6 +1091,7 @@ class ListEntitiesClimateResponse : public ProtoMessage {
 };
 class ClimateStateResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 47;
   uint32_t key{0};
   enums::ClimateMode mode{};
   float current_temperature{0.0f};
@@ -1056,6 +1119,7 @@ class ClimateStateResponse : public ProtoMessage {
 };
 class ClimateCommandRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 48;
   uint32_t key{0};
   bool has_mode{false};
   enums::ClimateMode mode{};
@@ -1091,6 +1155,7 @@ class ClimateCommandRequest : public ProtoMessage {
 };
 class ListEntitiesNumberResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 49;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -1116,6 +1181,7 @@ class ListEntitiesNumberResponse : public ProtoMessage {
 };
 class NumberStateResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 50;
   uint32_t key{0};
   float state{0.0f};
   bool missing_state{false};
@@ -1130,6 +1196,7 @@ class NumberStateResponse : public ProtoMessage {
 };
 class NumberCommandRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 51;
   uint32_t key{0};
   float state{0.0f};
   void encode(ProtoWriteBuffer buffer) const override;
@@ -1142,6 +1209,7 @@ class NumberCommandRequest : public ProtoMessage {
 };
 class ListEntitiesSelectResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 52;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -1162,6 +1230,7 @@ class ListEntitiesSelectResponse : public ProtoMessage {
 };
 class SelectStateResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 53;
   uint32_t key{0};
   std::string state{};
   bool missing_state{false};
@@ -1177,6 +1246,7 @@ class SelectStateResponse : public ProtoMessage {
 };
 class SelectCommandRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 54;
   uint32_t key{0};
   std::string state{};
   void encode(ProtoWriteBuffer buffer) const override;
@@ -1190,6 +1260,7 @@ class SelectCommandRequest : public ProtoMessage {
 };
 class ListEntitiesLockResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 58;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -1213,6 +1284,7 @@ class ListEntitiesLockResponse : public ProtoMessage {
 };
 class LockStateResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 59;
   uint32_t key{0};
   enums::LockState state{};
   void encode(ProtoWriteBuffer buffer) const override;
@@ -1226,6 +1298,7 @@ class LockStateResponse : public ProtoMessage {
 };
 class LockCommandRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 60;
   uint32_t key{0};
   enums::LockCommand command{};
   bool has_code{false};
@@ -1242,6 +1315,7 @@ class LockCommandRequest : public ProtoMessage {
 };
 class ListEntitiesButtonResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 61;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -1262,6 +1336,7 @@ class ListEntitiesButtonResponse : public ProtoMessage {
 };
 class ButtonCommandRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 62;
   uint32_t key{0};
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
@@ -1289,6 +1364,7 @@ class MediaPlayerSupportedFormat : public ProtoMessage {
 };
 class ListEntitiesMediaPlayerResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 63;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -1310,6 +1386,7 @@ class ListEntitiesMediaPlayerResponse : public ProtoMessage {
 };
 class MediaPlayerStateResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 64;
   uint32_t key{0};
   enums::MediaPlayerState state{};
   float volume{0.0f};
@@ -1325,6 +1402,7 @@ class MediaPlayerStateResponse : public ProtoMessage {
 };
 class MediaPlayerCommandRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 65;
   uint32_t key{0};
   bool has_command{false};
   enums::MediaPlayerCommand command{};
@@ -1346,6 +1424,7 @@ class MediaPlayerCommandRequest : public ProtoMessage {
 };
 class SubscribeBluetoothLEAdvertisementsRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 66;
   uint32_t flags{0};
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
@@ -1371,6 +1450,7 @@ class BluetoothServiceData : public ProtoMessage {
 };
 class BluetoothLEAdvertisementResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 67;
   uint64_t address{0};
   std::string name{};
   int32_t rssi{0};
@@ -1404,6 +1484,7 @@ class BluetoothLERawAdvertisement : public ProtoMessage {
 };
 class BluetoothLERawAdvertisementsResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 93;
   std::vector<BluetoothLERawAdvertisement> advertisements{};
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
@@ -1415,6 +1496,7 @@ class BluetoothLERawAdvertisementsResponse : public ProtoMessage {
 };
 class BluetoothDeviceRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 68;
   uint64_t address{0};
   enums::BluetoothDeviceRequestType request_type{};
   bool has_address_type{false};
@@ -1429,6 +1511,7 @@ class BluetoothDeviceRequest : public ProtoMessage {
 };
 class BluetoothDeviceConnectionResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 69;
   uint64_t address{0};
   bool connected{false};
   uint32_t mtu{0};
@@ -1443,6 +1526,7 @@ class BluetoothDeviceConnectionResponse : public ProtoMessage {
 };
 class BluetoothGATTGetServicesRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 70;
   uint64_t address{0};
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
@@ -1495,6 +1579,7 @@ class BluetoothGATTService : public ProtoMessage {
 };
 class BluetoothGATTGetServicesResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 71;
   uint64_t address{0};
   std::vector<BluetoothGATTService> services{};
   void encode(ProtoWriteBuffer buffer) const override;
@@ -1508,6 +1593,7 @@ class BluetoothGATTGetServicesResponse : public ProtoMessage {
 };
 class BluetoothGATTGetServicesDoneResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 72;
   uint64_t address{0};
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
@@ -1519,6 +1605,7 @@ class BluetoothGATTGetServicesDoneResponse : public ProtoMessage {
 };
 class BluetoothGATTReadRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 73;
   uint64_t address{0};
   uint32_t handle{0};
   void encode(ProtoWriteBuffer buffer) const override;
@@ -1531,6 +1618,7 @@ class BluetoothGATTReadRequest : public ProtoMessage {
 };
 class BluetoothGATTReadResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 74;
   uint64_t address{0};
   uint32_t handle{0};
   std::string data{};
@@ -1545,6 +1633,7 @@ class BluetoothGATTReadResponse : public ProtoMessage {
 };
 class BluetoothGATTWriteRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 75;
   uint64_t address{0};
   uint32_t handle{0};
   bool response{false};
@@ -1560,6 +1649,7 @@ class BluetoothGATTWriteRequest : public ProtoMessage {
 };
 class BluetoothGATTReadDescriptorRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 76;
   uint64_t address{0};
   uint32_t handle{0};
   void encode(ProtoWriteBuffer buffer) const override;
@@ -1572,6 +1662,7 @@ class BluetoothGATTReadDescriptorRequest : public ProtoMessage {
 };
 class BluetoothGATTWriteDescriptorRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 77;
   uint64_t address{0};
   uint32_t handle{0};
   std::string data{};
@@ -1586,6 +1677,7 @@ class BluetoothGATTWriteDescriptorRequest : public ProtoMessage {
 };
 class BluetoothGATTNotifyRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 78;
   uint64_t address{0};
   uint32_t handle{0};
   bool enable{false};
@@ -1599,6 +1691,7 @@ class BluetoothGATTNotifyRequest : public ProtoMessage {
 };
 class BluetoothGATTNotifyDataResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 79;
   uint64_t address{0};
   uint32_t handle{0};
   std::string data{};
@@ -1613,6 +1706,7 @@ class BluetoothGATTNotifyDataResponse : public ProtoMessage {
 };
 class SubscribeBluetoothConnectionsFreeRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 80;
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
@@ -1622,6 +1716,7 @@ class SubscribeBluetoothConnectionsFreeRequest : public ProtoMessage {
 };
 class BluetoothConnectionsFreeResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 81;
   uint32_t free{0};
   uint32_t limit{0};
   void encode(ProtoWriteBuffer buffer) const override;
@@ -1634,6 +1729,7 @@ class BluetoothConnectionsFreeResponse : public ProtoMessage {
 };
 class BluetoothGATTErrorResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 82;
   uint64_t address{0};
   uint32_t handle{0};
   int32_t error{0};
@@ -1647,6 +1743,7 @@ class BluetoothGATTErrorResponse : public ProtoMessage {
 };
 class BluetoothGATTWriteResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 83;
   uint64_t address{0};
   uint32_t handle{0};
   void encode(ProtoWriteBuffer buffer) const override;
@@ -1659,6 +1756,7 @@ class BluetoothGATTWriteResponse : public ProtoMessage {
 };
 class BluetoothGATTNotifyResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 84;
   uint64_t address{0};
   uint32_t handle{0};
   void encode(ProtoWriteBuffer buffer) const override;
@@ -1671,6 +1769,7 @@ class BluetoothGATTNotifyResponse : public ProtoMessage {
 };
 class BluetoothDevicePairingResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 85;
   uint64_t address{0};
   bool paired{false};
   int32_t error{0};
@@ -1684,6 +1783,7 @@ class BluetoothDevicePairingResponse : public ProtoMessage {
 };
 class BluetoothDeviceUnpairingResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 86;
   uint64_t address{0};
   bool success{false};
   int32_t error{0};
@@ -1697,6 +1797,7 @@ class BluetoothDeviceUnpairingResponse : public ProtoMessage {
 };
 class UnsubscribeBluetoothLEAdvertisementsRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 87;
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
@@ -1706,6 +1807,7 @@ class UnsubscribeBluetoothLEAdvertisementsRequest : public ProtoMessage {
 };
 class BluetoothDeviceClearCacheResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 88;
   uint64_t address{0};
   bool success{false};
   int32_t error{0};
@@ -1719,6 +1821,7 @@ class BluetoothDeviceClearCacheResponse : public ProtoMessage {
 };
 class SubscribeVoiceAssistantRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 89;
   bool subscribe{false};
   uint32_t flags{0};
   void encode(ProtoWriteBuffer buffer) const override;
@@ -1745,6 +1848,7 @@ class VoiceAssistantAudioSettings : public ProtoMessage {
 };
 class VoiceAssistantRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 90;
   bool start{false};
   std::string conversation_id{};
   uint32_t flags{0};
@@ -1761,6 +1865,7 @@ class VoiceAssistantRequest : public ProtoMessage {
 };
 class VoiceAssistantResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 91;
   uint32_t port{0};
   bool error{false};
   void encode(ProtoWriteBuffer buffer) const override;
@@ -1785,6 +1890,7 @@ class VoiceAssistantEventData : public ProtoMessage {
 };
 class VoiceAssistantEventResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 92;
   enums::VoiceAssistantEvent event_type{};
   std::vector<VoiceAssistantEventData> data{};
   void encode(ProtoWriteBuffer buffer) const override;
@@ -1798,6 +1904,7 @@ class VoiceAssistantEventResponse : public ProtoMessage {
 };
 class VoiceAssistantAudio : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 106;
   std::string data{};
   bool end{false};
   void encode(ProtoWriteBuffer buffer) const override;
@@ -1811,6 +1918,7 @@ class VoiceAssistantAudio : public ProtoMessage {
 };
 class VoiceAssistantTimerEventResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 115;
   enums::VoiceAssistantTimerEvent event_type{};
   std::string timer_id{};
   std::string name{};
@@ -1828,6 +1936,7 @@ class VoiceAssistantTimerEventResponse : public ProtoMessage {
 };
 class VoiceAssistantAnnounceRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 119;
   std::string media_id{};
   std::string text{};
   void encode(ProtoWriteBuffer buffer) const override;
@@ -1840,6 +1949,7 @@ class VoiceAssistantAnnounceRequest : public ProtoMessage {
 };
 class VoiceAssistantAnnounceFinished : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 120;
   bool success{false};
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
@@ -1864,6 +1974,7 @@ class VoiceAssistantWakeWord : public ProtoMessage {
 };
 class VoiceAssistantConfigurationRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 121;
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
   void dump_to(std::string &out) const override;
@@ -1873,6 +1984,7 @@ class VoiceAssistantConfigurationRequest : public ProtoMessage {
 };
 class VoiceAssistantConfigurationResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 122;
   std::vector<VoiceAssistantWakeWord> available_wake_words{};
   std::vector<std::string> active_wake_words{};
   uint32_t max_active_wake_words{0};
@@ -1887,6 +1999,7 @@ class VoiceAssistantConfigurationResponse : public ProtoMessage {
 };
 class VoiceAssistantSetConfiguration : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 123;
   std::vector<std::string> active_wake_words{};
   void encode(ProtoWriteBuffer buffer) const override;
 #ifdef HAS_PROTO_MESSAGE_DUMP
@@ -1898,6 +2011,7 @@ class VoiceAssistantSetConfiguration : public ProtoMessage {
 };
 class ListEntitiesAlarmControlPanelResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 94;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -1920,6 +2034,7 @@ class ListEntitiesAlarmControlPanelResponse : public ProtoMessage {
 };
 class AlarmControlPanelStateResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 95;
   uint32_t key{0};
   enums::AlarmControlPanelState state{};
   void encode(ProtoWriteBuffer buffer) const override;
@@ -1933,6 +2048,7 @@ class AlarmControlPanelStateResponse : public ProtoMessage {
 };
 class AlarmControlPanelCommandRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 96;
   uint32_t key{0};
   enums::AlarmControlPanelStateCommand command{};
   std::string code{};
@@ -1948,6 +2064,7 @@ class AlarmControlPanelCommandRequest : public ProtoMessage {
 };
 class ListEntitiesTextResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 97;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -1971,6 +2088,7 @@ class ListEntitiesTextResponse : public ProtoMessage {
 };
 class TextStateResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 98;
   uint32_t key{0};
   std::string state{};
   bool missing_state{false};
@@ -1986,6 +2104,7 @@ class TextStateResponse : public ProtoMessage {
 };
 class TextCommandRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 99;
   uint32_t key{0};
   std::string state{};
   void encode(ProtoWriteBuffer buffer) const override;
@@ -1999,6 +2118,7 @@ class TextCommandRequest : public ProtoMessage {
 };
 class ListEntitiesDateResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 100;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -2018,6 +2138,7 @@ class ListEntitiesDateResponse : public ProtoMessage {
 };
 class DateStateResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 101;
   uint32_t key{0};
   bool missing_state{false};
   uint32_t year{0};
@@ -2034,6 +2155,7 @@ class DateStateResponse : public ProtoMessage {
 };
 class DateCommandRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 102;
   uint32_t key{0};
   uint32_t year{0};
   uint32_t month{0};
@@ -2049,6 +2171,7 @@ class DateCommandRequest : public ProtoMessage {
 };
 class ListEntitiesTimeResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 103;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -2068,6 +2191,7 @@ class ListEntitiesTimeResponse : public ProtoMessage {
 };
 class TimeStateResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 104;
   uint32_t key{0};
   bool missing_state{false};
   uint32_t hour{0};
@@ -2084,6 +2208,7 @@ class TimeStateResponse : public ProtoMessage {
 };
 class TimeCommandRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 105;
   uint32_t key{0};
   uint32_t hour{0};
   uint32_t minute{0};
@@ -2099,6 +2224,7 @@ class TimeCommandRequest : public ProtoMessage {
 };
 class ListEntitiesEventResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 107;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -2120,6 +2246,7 @@ class ListEntitiesEventResponse : public ProtoMessage {
 };
 class EventResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 108;
   uint32_t key{0};
   std::string event_type{};
   void encode(ProtoWriteBuffer buffer) const override;
@@ -2133,6 +2260,7 @@ class EventResponse : public ProtoMessage {
 };
 class ListEntitiesValveResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 109;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -2156,6 +2284,7 @@ class ListEntitiesValveResponse : public ProtoMessage {
 };
 class ValveStateResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 110;
   uint32_t key{0};
   float position{0.0f};
   enums::ValveOperation current_operation{};
@@ -2170,6 +2299,7 @@ class ValveStateResponse : public ProtoMessage {
 };
 class ValveCommandRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 111;
   uint32_t key{0};
   bool has_position{false};
   float position{0.0f};
@@ -2185,6 +2315,7 @@ class ValveCommandRequest : public ProtoMessage {
 };
 class ListEntitiesDateTimeResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 112;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -2204,6 +2335,7 @@ class ListEntitiesDateTimeResponse : public ProtoMessage {
 };
 class DateTimeStateResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 113;
   uint32_t key{0};
   bool missing_state{false};
   uint32_t epoch_seconds{0};
@@ -2218,6 +2350,7 @@ class DateTimeStateResponse : public ProtoMessage {
 };
 class DateTimeCommandRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 114;
   uint32_t key{0};
   uint32_t epoch_seconds{0};
   void encode(ProtoWriteBuffer buffer) const override;
@@ -2230,6 +2363,7 @@ class DateTimeCommandRequest : public ProtoMessage {
 };
 class ListEntitiesUpdateResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 116;
   std::string object_id{};
   uint32_t key{0};
   std::string name{};
@@ -2250,6 +2384,7 @@ class ListEntitiesUpdateResponse : public ProtoMessage {
 };
 class UpdateStateResponse : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 117;
   uint32_t key{0};
   bool missing_state{false};
   bool in_progress{false};
@@ -2272,6 +2407,7 @@ class UpdateStateResponse : public ProtoMessage {
 };
 class UpdateCommandRequest : public ProtoMessage {
  public:
+  static constexpr uint16_t MESSAGE_TYPE = 118;
   uint32_t key{0};
   enums::UpdateCommand command{};
   void encode(ProtoWriteBuffer buffer) const override;
@@ -142,6 +142,8 @@ bool APIServerConnectionBase::send_sensor_state_response(const SensorStateRespon
   return this->send_message_<SensorStateResponse>(msg, 25);
 }
 #endif
+#ifdef USE_SENSOR
+#endif
 #ifdef USE_SWITCH
 bool APIServerConnectionBase::send_list_entities_switch_response(const ListEntitiesSwitchResponse &msg) {
 #ifdef HAS_PROTO_MESSAGE_DUMP
@@ -1191,6 +1193,17 @@ bool APIServerConnectionBase::read_message(uint32_t msg_size, uint32_t msg_type,
       ESP_LOGVV(TAG, "on_voice_assistant_set_configuration: %s", msg.dump().c_str());
 #endif
       this->on_voice_assistant_set_configuration(msg);
+#endif
+      break;
+    }
+    case 124: {
+#ifdef USE_SENSOR
+      SensorStateFilterRequest msg;
+      msg.decode(msg_data, msg_size);
+#ifdef HAS_PROTO_MESSAGE_DUMP
+      ESP_LOGVV(TAG, "on_sensor_state_filter_request: %s", msg.dump().c_str());
+#endif
+      this->on_sensor_state_filter_request(msg);
 #endif
       break;
     }
@@ -1256,6 +1269,19 @@ void APIServerConnection::on_subscribe_states_request(const SubscribeStatesReque
   }
   this->subscribe_states(msg);
 }
+#ifdef USE_SENSOR
+void APIServerConnection::on_sensor_state_filter_request(const SensorStateFilterRequest &msg) {
+  if (!this->is_connection_setup()) {
+    this->on_no_setup_connection();
+    return;
+  }
+  if (!this->is_authenticated()) {
+    this->on_unauthenticated_access();
+    return;
+  }
+  this->sensor_state_filter(msg);
+}
+#endif
 void APIServerConnection::on_subscribe_logs_request(const SubscribeLogsRequest &msg) {
   if (!this->is_connection_setup()) {
     this->on_no_setup_connection();
@@ -66,6 +66,9 @@ class APIServerConnectionBase : public ProtoService {
 #ifdef USE_SENSOR
   bool send_sensor_state_response(const SensorStateResponse &msg);
 #endif
+#ifdef USE_SENSOR
+  virtual void on_sensor_state_filter_request(const SensorStateFilterRequest &value){};
+#endif
 #ifdef USE_SWITCH
   bool send_list_entities_switch_response(const ListEntitiesSwitchResponse &msg);
 #endif
@@ -344,6 +347,9 @@ class APIServerConnection : public APIServerConnectionBase {
   virtual DeviceInfoResponse device_info(const DeviceInfoRequest &msg) = 0;
   virtual void list_entities(const ListEntitiesRequest &msg) = 0;
   virtual void subscribe_states(const SubscribeStatesRequest &msg) = 0;
+#ifdef USE_SENSOR
+  virtual void sensor_state_filter(const SensorStateFilterRequest &msg) = 0;
+#endif
   virtual void subscribe_logs(const SubscribeLogsRequest &msg) = 0;
   virtual void subscribe_homeassistant_services(const SubscribeHomeassistantServicesRequest &msg) = 0;
   virtual void subscribe_home_assistant_states(const SubscribeHomeAssistantStatesRequest &msg) = 0;
@@ -452,6 +458,9 @@ class APIServerConnection : public APIServerConnectionBase {
   void on_device_info_request(const DeviceInfoRequest &msg) override;
   void on_list_entities_request(const ListEntitiesRequest &msg) override;
   void on_subscribe_states_request(const SubscribeStatesRequest &msg) override;
+#ifdef USE_SENSOR
+  void on_sensor_state_filter_request(const SensorStateFilterRequest &msg) override;
+#endif
   void on_subscribe_logs_request(const SubscribeLogsRequest &msg) override;
   void on_subscribe_homeassistant_services_request(const SubscribeHomeassistantServicesRequest &msg) override;
   void on_subscribe_home_assistant_states_request(const SubscribeHomeAssistantStatesRequest &msg) override;
@@ -25,7 +25,7 @@ static const char *const TAG = "api";
 void APIServer::setup() {
   ESP_LOGCONFIG(TAG, "Setting up Home Assistant API server...");
   this->setup_controller();
-  socket_ = socket::socket_ip(SOCK_STREAM, 0);
+  socket_ = socket::socket_ip_loop_monitored(SOCK_STREAM, 0);
   if (socket_ == nullptr) {
     ESP_LOGW(TAG, "Could not create socket.");
     this->mark_failed();
@@ -60,7 +60,7 @@ void APIServer::setup() {
     return;
   }
 
-  err = socket_->listen(4);
+  err = socket_->listen(this->max_connections_);
   if (err != 0) {
     ESP_LOGW(TAG, "Socket unable to listen: errno %d", errno);
     this->mark_failed();
@@ -94,12 +94,18 @@ void APIServer::setup() {
 }
 void APIServer::loop() {
   // Accept new clients
-  while (true) {
+  while (this->socket_->ready()) {
     struct sockaddr_storage source_addr;
     socklen_t addr_len = sizeof(source_addr);
     auto sock = socket_->accept((struct sockaddr *) &source_addr, &addr_len);
     if (!sock)
       break;
+    if (this->clients_.size() >= this->max_connections_) {
+      // Close right away rather than leaving it in the backlog, where it would keep the listening socket ready
+      ESP_LOGW(TAG, "Rejecting %s, already serving %zu clients", sock->getpeername().c_str(), this->clients_.size());
+      sock->close();
+      continue;
+    }
     ESP_LOGD(TAG, "Accepted %s", sock->getpeername().c_str());
 
     auto *conn = new APIConnection(std::move(sock), this);
@@ -139,6 +145,7 @@ void APIServer::loop() {
 void APIServer::dump_config() {
   ESP_LOGCONFIG(TAG, "API Server:");
   ESP_LOGCONFIG(TAG, "  Address: %s:%u", network::get_use_address().c_str(), this->port_);
+  ESP_LOGCONFIG(TAG, "  Max connections: %u", this->max_connections_);
 #ifdef USE_API_NOISE
   ESP_LOGCONFIG(TAG, "  Using noise encryption: YES");
 #else
@@ -377,6 +384,7 @@ const std::vector<APIServer::HomeAssistantStateSubscription> &APIServer::get_sta
 }
 uint16_t APIServer::get_port() const { return this->port_; }
 void APIServer::set_reboot_timeout(uint32_t reboot_timeout) { this->reboot_timeout_ = reboot_timeout; }
+void APIServer::set_max_connections(uint8_t max_connections) { this->max_connections_ = max_connections; }
 #ifdef USE_HOMEASSISTANT_TIME
 void APIServer::request_time() {
   for (auto &client : this->clients_) {
@@ -33,6 +33,12 @@ class APIServer : public Component, public Controller {
   void set_port(uint16_t port);
   void set_password(const std::string &password);
   void set_reboot_timeout(uint32_t reboot_timeout);
+  void set_cache_list_entities(bool cache_list_entities) { this->cache_list_entities_ = cache_list_entities; }
+  /// The shared list of encoded entity info messages, or nullptr if caching is disabled.
+  ListEntitiesCache *get_list_entities_cache() {
+    return this->cache_list_entities_ ? &this->list_entities_cache_ : nullptr;
+  }
+  void set_max_connections(uint8_t max_connections);
 
 #ifdef USE_API_NOISE
   void set_noise_psk(psk_t psk) { noise_ctx_->set_psk(psk); }
@@ -132,6 +138,9 @@ class APIServer : public Component, public Controller {
   std::unique_ptr<socket::Socket> socket_ = nullptr;
   uint16_t port_{6053};
   uint32_t reboot_timeout_{300000};
+  uint8_t max_connections_{8};
+  bool cache_list_entities_{false};
+  ListEntitiesCache list_entities_cache_;
   uint32_t last_connected_{0};
   std::vector<std::unique_ptr<APIConnection>> clients_;
   std::string password_;
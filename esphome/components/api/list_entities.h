@@ -4,11 +4,44 @@
 #ifdef USE_API
 #include "esphome/core/component.h"
 #include "esphome/core/component_iterator.h"
+
+#include <vector>
+
 namespace esphome {
 namespace api {
 
 class APIConnection;
 
+/** Encoded ListEntities*Response messages, in the order the iterator sends them.
+ *
+ * Entity info only changes with the firmware, so the messages one connection sends while listing the entities can
+ * be replayed to every later connection without visiting and encoding each entity again.
+ */
+struct ListEntitiesCache {
+  struct Message {
+    uint16_t type;
+    uint32_t offset;
+    uint32_t length;
+  };
+
+  void add(uint16_t type, const uint8_t *data, size_t length) {
+    this->messages.push_back(Message{type, static_cast<uint32_t>(this->data.size()), static_cast<uint32_t>(length)});
+    this->data.insert(this->data.end(), data, data + length);
+  }
+  void clear() {
+    this->messages.clear();
+    this->data.clear();
+    this->complete = false;
+  }
+
+  std::vector<Message> messages;
+  std::vector<uint8_t> data;
+  /// Set once a connection has sent the whole listing, including ListEntitiesDoneResponse.
+  bool complete{false};
+  /// The connection currently recording the listing.
+  const APIConnection *recorder{nullptr};
+};
+
 class ListEntitiesIterator : public ComponentIterator {
  public:
   ListEntitiesIterator(APIConnection *client);
@@ -39,6 +39,7 @@ void AXS15231Touchscreen::update_touches() {
   i2c::ErrorCode err;
   uint8_t data[8]{};
 
+  i2c::I2CBusLock lock(this->bus_);
   err = this->write(AXS_READ_TOUCHPAD, sizeof(AXS_READ_TOUCHPAD), false);
   ERROR_CHECK(err);
   err = this->read(data, sizeof(data));
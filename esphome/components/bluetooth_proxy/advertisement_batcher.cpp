@@ -0,0 +1,60 @@
+#include "advertisement_batcher.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace bluetooth_proxy {
+
+AdvertisementBatcher::AdvertisementBatcher(size_t max_bytes, uint32_t max_delay)
+    : max_bytes_(max_bytes), max_delay_(max_delay) {
+  this->advertisements_.reserve(max_bytes / encoded_size_(0));
+}
+
+bool AdvertisementBatcher::add(uint64_t address, int rssi, uint8_t address_type, const uint8_t *data, uint8_t length,
+                               uint32_t now) {
+  this->advertisements_in_++;
+  length = std::min<uint8_t>(length, sizeof(BatchedAdvertisement::data));
+  for (auto &queued : this->advertisements_) {
+    if (queued.address == address && queued.length == length && memcmp(queued.data, data, length) == 0) {
+      queued.rssi = rssi;
+      this->advertisements_merged_++;
+      return false;
+    }
+  }
+
+  if (this->advertisements_.empty())
+    this->first_time_ = now;
+  this->advertisements_.emplace_back();
+  auto &adv = this->advertisements_.back();
+  adv.address = address;
+  adv.rssi = rssi;
+  adv.address_type = address_type;
+  adv.length = length;
+  memcpy(adv.data, data, length);
+  this->bytes_ += encoded_size_(length);
+  return true;
+}
+
+bool AdvertisementBatcher::is_full_for(uint8_t length) const {
+  return !this->advertisements_.empty() && this->bytes_ + encoded_size_(length) > this->max_bytes_;
+}
+
+bool AdvertisementBatcher::is_due(uint32_t now) const {
+  if (this->advertisements_.empty())
+    return false;
+  return this->bytes_ >= this->max_bytes_ || now - this->first_time_ >= this->max_delay_;
+}
+
+void AdvertisementBatcher::finish(bool sent) {
+  if (sent) {
+    this->advertisements_out_ += this->advertisements_.size();
+  } else {
+    this->advertisements_dropped_ += this->advertisements_.size();
+  }
+  this->advertisements_.clear();
+  this->bytes_ = 0;
+}
+
+}  // namespace bluetooth_proxy
+}  // namespace esphome
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace esphome {
+namespace bluetooth_proxy {
+
+struct BatchedAdvertisement {
+  uint64_t address;
+  int8_t rssi;
+  uint8_t address_type;
+  uint8_t length;
+  /// Advertisement followed by the scan response.
+  uint8_t data[62];
+};
+
+/** Collects raw advertisements into batches so that they can be forwarded with fewer API messages.
+ *
+ * A batch is due once its estimated encoded size reaches the byte budget or its oldest advertisement has waited
+ * for the maximum delay. An advertisement that repeats one already in the batch byte for byte only refreshes the
+ * RSSI of the queued copy.
+ *
+ * Storage for a full batch is allocated up front; this class has no platform dependencies.
+ */
+class AdvertisementBatcher {
+ public:
+  AdvertisementBatcher(size_t max_bytes, uint32_t max_delay);
+
+  /// Queue an advertisement received at \p now. Returns false if it was merged into an identical queued one.
+  bool add(uint64_t address, int rssi, uint8_t address_type, const uint8_t *data, uint8_t length, uint32_t now);
+  /// Whether adding an advertisement of \p length bytes would exceed the byte budget, i.e. the batch has to be
+  /// flushed first.
+  bool is_full_for(uint8_t length) const;
+  /// Whether the batch should be sent at \p now.
+  bool is_due(uint32_t now) const;
+
+  bool empty() const { return this->advertisements_.empty(); }
+  const std::vector<BatchedAdvertisement> &get_advertisements() const { return this->advertisements_; }
+  /// Empty the batch after it was sent (or \p sent is false: dropped).
+  void finish(bool sent);
+
+  uint32_t get_advertisements_in() const { return this->advertisements_in_; }
+  uint32_t get_advertisements_out() const { return this->advertisements_out_; }
+  uint32_t get_advertisements_merged() const { return this->advertisements_merged_; }
+  uint32_t get_advertisements_dropped() const { return this->advertisements_dropped_; }
+
+ protected:
+  /// Upper bound of the encoded size of one advertisement (field tags, varints and data).
+  static size_t encoded_size_(uint8_t length) { return length + 20; }
+
+  std::vector<BatchedAdvertisement> advertisements_;
+  size_t max_bytes_;
+  size_t bytes_{0};
+  uint32_t max_delay_;
+  uint32_t first_time_{0};
+  uint32_t advertisements_in_{0};
+  uint32_t advertisements_out_{0};
+  uint32_t advertisements_merged_{0};
+  uint32_t advertisements_dropped_{0};
+};
+
+}  // namespace bluetooth_proxy
+}  // namespace esphome
@@ -1,5 +1,7 @@
 #include "bluetooth_proxy.h"
 
+#include <cinttypes>
+
 #include "esphome/core/log.h"
 #include "esphome/core/macros.h"
 
@@ -39,29 +41,39 @@ bool BluetoothProxy::parse_devices(esp_ble_gap_cb_param_t::ble_scan_result_evt_p
   if (!api::global_api_server->is_connected() || this->api_connection_ == nullptr || !this->raw_advertisements_)
     return false;
 
-  api::BluetoothLERawAdvertisementsResponse resp;
+  const uint32_t now = millis();
   for (size_t i = 0; i < count; i++) {
     auto &result = advertisements[i];
-    api::BluetoothLERawAdvertisement adv;
-    adv.address = esp32_ble::ble_addr_to_uint64(result.bda);
-    adv.rssi = result.rssi;
-    adv.address_type = result.ble_addr_type;
-
     uint8_t length = result.adv_data_len + result.scan_rsp_len;
-    adv.data.reserve(length);
-    for (uint16_t i = 0; i < length; i++) {
-      adv.data.push_back(result.ble_adv[i]);
-    }
-
-    resp.advertisements.push_back(std::move(adv));
+    if (this->advertisement_batcher_.is_full_for(length))
+      this->flush_advertisements_();
+    this->advertisement_batcher_.add(esp32_ble::ble_addr_to_uint64(result.bda), result.rssi, result.ble_addr_type,
+                                     result.ble_adv, length, now);
 
     ESP_LOGV(TAG, "Proxying raw packet from %02X:%02X:%02X:%02X:%02X:%02X, length %d. RSSI: %d dB", result.bda[0],
              result.bda[1], result.bda[2], result.bda[3], result.bda[4], result.bda[5], length, result.rssi);
   }
-  ESP_LOGV(TAG, "Proxying %d packets", count);
-  this->api_connection_->send_bluetooth_le_raw_advertisements_response(resp);
+  if (this->advertisement_batcher_.is_due(now))
+    this->flush_advertisements_();
   return true;
 }
+void BluetoothProxy::flush_advertisements_() {
+  const auto &batch = this->advertisement_batcher_.get_advertisements();
+  // The response and the strings of its advertisements are reused between batches
+  auto &resp = this->advertisements_response_;
+  resp.advertisements.resize(batch.size());
+  for (size_t i = 0; i < batch.size(); i++) {
+    auto &adv = resp.advertisements[i];
+    adv.address = batch[i].address;
+    adv.rssi = batch[i].rssi;
+    adv.address_type = batch[i].address_type;
+    adv.data.assign(reinterpret_cast<const char *>(batch[i].data), batch[i].length);
+  }
+  ESP_LOGV(TAG, "Proxying %zu packets", batch.size());
+  bool sent =
+      this->api_connection_ != nullptr && this->api_connection_->send_bluetooth_le_raw_advertisements_response(resp);
+  this->advertisement_batcher_.finish(sent);
+}
 void BluetoothProxy::send_api_packet_(const esp32_ble_tracker::ESPBTDevice &device) {
   api::BluetoothLEAdvertisementResponse resp;
   resp.address = device.address_uint64();
@@ -92,6 +104,8 @@ void BluetoothProxy::dump_config() {
   ESP_LOGCONFIG(TAG, "  Active: %s", YESNO(this->active_));
   ESP_LOGCONFIG(TAG, "  Connections: %d", this->connections_.size());
   ESP_LOGCONFIG(TAG, "  Raw advertisements: %s", YESNO(this->raw_advertisements_));
+  ESP_LOGCONFIG(TAG, "  Advertisement batches: up to %zu bytes / %" PRIu32 " ms", ADVERTISEMENT_BATCH_BYTES,
+                ADVERTISEMENT_BATCH_DELAY);
 }
 
 int BluetoothProxy::get_bluetooth_connections_free() {
@@ -117,6 +131,8 @@ void BluetoothProxy::loop() {
     }
     return;
   }
+  if (this->advertisement_batcher_.is_due(millis()))
+    this->flush_advertisements_();
   for (auto *connection : this->connections_) {
     if (connection->send_service_ == connection->service_count_) {
       connection->send_service_ = DONE_SENDING_SERVICES;
@@ -456,6 +472,8 @@ void BluetoothProxy::unsubscribe_api_connection(api::APIConnection *api_connecti
   }
   this->api_connection_ = nullptr;
   this->raw_advertisements_ = false;
+  if (!this->advertisement_batcher_.empty())
+    this->advertisement_batcher_.finish(false);
   this->parent_->recalculate_advertisement_parser_types();
 }
 
@@ -13,6 +13,7 @@
 #include "esphome/core/component.h"
 #include "esphome/core/defines.h"
 
+#include "advertisement_batcher.h"
 #include "bluetooth_connection.h"
 
 namespace esphome {
@@ -31,6 +32,11 @@ using namespace esp32_ble_client;
 static const uint32_t LEGACY_ACTIVE_CONNECTIONS_VERSION = 5;
 static const uint32_t LEGACY_PASSIVE_ONLY_VERSION = 1;
 
+/// Raw advertisements are sent once a batch reaches this encoded size...
+static const size_t ADVERTISEMENT_BATCH_BYTES = 1024;
+/// ...or its oldest advertisement has waited this long (ms).
+static const uint32_t ADVERTISEMENT_BATCH_DELAY = 100;
+
 enum BluetoothProxyFeature : uint32_t {
   FEATURE_PASSIVE_SCAN = 1 << 0,
   FEATURE_ACTIVE_CONNECTIONS = 1 << 1,
@@ -93,6 +99,8 @@ class BluetoothProxy : public esp32_ble_tracker::ESPBTDeviceListener, public Com
   void set_active(bool active) { this->active_ = active; }
   bool has_active() { return this->active_; }
 
+  const AdvertisementBatcher &get_advertisement_batcher() const { return this->advertisement_batcher_; }
+
   uint32_t get_legacy_version() const {
     if (this->active_) {
       return LEGACY_ACTIVE_CONNECTIONS_VERSION;
@@ -116,6 +124,8 @@ class BluetoothProxy : public esp32_ble_tracker::ESPBTDeviceListener, public Com
 
  protected:
   void send_api_packet_(const esp32_ble_tracker::ESPBTDevice &device);
+  /// Send the queued raw advertisements in one message.
+  void flush_advertisements_();
 
   BluetoothConnection *get_connection_(uint64_t address, bool reserve);
 
@@ -124,6 +134,8 @@ class BluetoothProxy : public esp32_ble_tracker::ESPBTDeviceListener, public Com
   std::vector<BluetoothConnection *> connections_{};
   api::APIConnection *api_connection_{nullptr};
   bool raw_advertisements_{false};
+  AdvertisementBatcher advertisement_batcher_{ADVERTISEMENT_BATCH_BYTES, ADVERTISEMENT_BATCH_DELAY};
+  api::BluetoothLERawAdvertisementsResponse advertisements_response_;
 };
 
 extern BluetoothProxy *global_bluetooth_proxy;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
@@ -241,12 +241,16 @@ void BME680Component::update() {
   meas_control |= (this->temperature_oversampling_ & 0b111) << 5;
   meas_control |= (this->pressure_oversampling_ & 0b111) << 2;
   meas_control |= 0b01;  // forced mode
-  if (!this->write_byte(BME680_REGISTER_CONTROL_MEAS, meas_control)) {
-    this->status_set_warning();
-    return;
-  }
-
-  this->set_timeout("data", this->calc_meas_duration_(), [this]() { this->read_data_(); });
+  // Through the bus' transaction queue, if it has one, so the transfers don't block the main loop.
+  std::vector<i2c::I2CTransfer> transfers(1);
+  transfers[0].write = {BME680_REGISTER_CONTROL_MEAS, meas_control};
+  this->submit(std::move(transfers), [this](i2c::ErrorCode err, const std::vector<uint8_t> &data) {
+    if (err != i2c::ERROR_OK) {
+      this->status_set_warning();
+      return;
+    }
+    this->set_timeout("data", this->calc_meas_duration_(), [this]() { this->read_data_(); });
+  });
 }
 
 uint8_t BME680Component::calc_heater_resistance_(uint16_t temperature) {
@@ -297,8 +301,16 @@ uint8_t BME680Component::calc_heater_duration_(uint16_t duration) {
   return duration_value;
 }
 void BME680Component::read_data_() {
-  uint8_t data[15];
-  if (!this->read_bytes(BME680_REGISTER_FIELD0, data, 15)) {
+  std::vector<i2c::I2CTransfer> transfers(2);
+  transfers[0].write = {BME680_REGISTER_FIELD0};
+  transfers[1].read_len = 15;
+  this->submit(std::move(transfers), [this](i2c::ErrorCode err, const std::vector<uint8_t> &data) {
+    this->publish_data_(err == i2c::ERROR_OK ? data.data() : nullptr);
+  });
+}
+
+void BME680Component::publish_data_(const uint8_t *data) {
+  if (data == nullptr) {
     if (this->temperature_sensor_ != nullptr)
       this->temperature_sensor_->publish_state(NAN);
     if (this->pressure_sensor_ != nullptr)
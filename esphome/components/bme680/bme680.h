@@ -109,6 +109,8 @@ class BME680Component : public PollingComponent, public i2c::I2CDevice {
   uint8_t calc_heater_duration_(uint16_t duration);
   /// Read data from the BME680 and publish results.
   void read_data_();
+  /// Publish the 15 bytes read from the field registers, or NAN for all sensors if @p data is nullptr.
+  void publish_data_(const uint8_t *data);
 
   /// Calculate the temperature in °C using the provided raw ADC value.
   float calc_temperature_(uint32_t raw_temperature);
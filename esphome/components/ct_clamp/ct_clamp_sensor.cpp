@@ -1,6 +1,8 @@
 #include "ct_clamp_sensor.h"
 
+#include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
+#include <algorithm>
 #include <cinttypes>
 #include <cmath>
 
@@ -9,9 +11,14 @@ namespace ct_clamp {
 
 static const char *const TAG = "ct_clamp";
 
+static const size_t MAX_BLOCK_SIZE = 64;
+/// Upper limit for the time a single block keeps the main loop busy.
+static const uint32_t MAX_BLOCK_DURATION_US = 10000;
+
 void CTClampSensor::dump_config() {
   LOG_SENSOR("", "CT Clamp Sensor", this);
   ESP_LOGCONFIG(TAG, "  Sample Duration: %.2fs", this->sample_duration_ / 1e3f);
+  ESP_LOGCONFIG(TAG, "  Sample Rate: %" PRIu32 " Hz", this->sample_rate_);
   LOG_UPDATE_INTERVAL(this);
 }
 
@@ -38,14 +45,22 @@ void CTClampSensor::update() {
     float rms_ac = 0;
     if (rms_ac_squared > 0)
       rms_ac = std::sqrt(rms_ac_squared);
-    ESP_LOGD(TAG, "'%s' - Raw AC Value: %.3fA after %" PRIu32 " different samples (%" PRIu32 " SPS)",
-             this->name_.c_str(), rms_ac, this->num_samples_, 1000 * this->num_samples_ / this->sample_duration_);
+    // Blocks are sampled at sample_rate_, the overall rate is lower by the time between blocks.
+    ESP_LOGD(TAG, "'%s' - Raw AC Value: %.3fA from %" PRIu32 " samples in blocks at %" PRIu32 " Hz (%" PRIu32
+             " SPS overall)", this->name_.c_str(), rms_ac, this->num_samples_, this->sample_rate_,
+             1000 * this->num_samples_ / this->sample_duration_);
+    // A source slower than the requested rate stretches the blocks, which the time limit then cuts short.
+    const uint32_t block_rate = uint64_t(this->num_samples_) * 1000000 / std::max<uint32_t>(this->block_time_us_, 1);
+    if (block_rate < this->sample_rate_ * 95 / 100) {
+      ESP_LOGW(TAG, "'%s' - Source only reached %" PRIu32 " of the requested %" PRIu32 " Hz, lower sample_rate",
+               this->name_.c_str(), block_rate, this->sample_rate_);
+    }
     this->publish_state(rms_ac);
   });
 
   // Set sampling values
-  this->last_value_ = 0.0;
   this->num_samples_ = 0;
+  this->block_time_us_ = 0;
   this->sample_sum_ = 0.0f;
   this->sample_squared_sum_ = 0.0f;
   this->is_sampling_ = true;
@@ -55,19 +70,29 @@ void CTClampSensor::loop() {
   if (!this->is_sampling_)
     return;
 
-  // Perform a single sample
-  float value = this->source_->sample();
-  if (std::isnan(value))
-    return;
-
-  // Assuming a sine wave, avoid requesting values faster than the ADC can provide them
-  if (this->last_value_ == value)
+  // Sample at a fixed rate in blocks of about 10ms, so the sample rate does not depend on how long the other
+  // components take in the main loop.
+  float block[MAX_BLOCK_SIZE];
+  const size_t block_size = clamp<size_t>(this->sample_rate_ / 100, 1, MAX_BLOCK_SIZE);
+  const uint32_t start = micros();
+  const size_t count =
+      this->source_->sample_block(block, block_size, 1000000 / this->sample_rate_, MAX_BLOCK_DURATION_US);
+  this->block_time_us_ += micros() - start;
+  if (count == 0)
     return;
-  this->last_value_ = value;
 
-  this->num_samples_++;
-  this->sample_sum_ += value;
-  this->sample_squared_sum_ += value * value;
+  if (this->num_samples_ == 0)
+    this->reference_ = block[0];
+  float sum = 0.0f;
+  float squared_sum = 0.0f;
+  for (size_t i = 0; i < count; i++) {
+    const float value = block[i] - this->reference_;
+    sum += value;
+    squared_sum += value * value;
+  }
+  this->num_samples_ += count;
+  this->sample_sum_ += sum;
+  this->sample_squared_sum_ += squared_sum;
 }
 
 }  // namespace ct_clamp
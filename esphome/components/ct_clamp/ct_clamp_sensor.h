@@ -19,6 +19,7 @@ class CTClampSensor : public sensor::Sensor, public PollingComponent {
   }
 
   void set_sample_duration(uint32_t sample_duration) { sample_duration_ = sample_duration; }
+  void set_sample_rate(uint32_t sample_rate) { sample_rate_ = sample_rate; }
   void set_source(voltage_sampler::VoltageSampler *source) { source_ = source; }
 
  protected:
@@ -27,6 +28,8 @@ class CTClampSensor : public sensor::Sensor, public PollingComponent {
 
   /// Duration in ms of the sampling phase.
   uint32_t sample_duration_;
+  /// Samples per second requested from the source.
+  uint32_t sample_rate_{4000};
   /// The sampling source to read values from.
   voltage_sampler::VoltageSampler *source_;
 
@@ -41,12 +44,17 @@ class CTClampSensor : public sensor::Sensor, public PollingComponent {
    *   2) Sum of samples
    *   3) Sum of sample squared
    * https://en.wikipedia.org/wiki/Root_mean_square
+   *
+   * The sums are taken relative to the first sample (close to the DC offset), otherwise the small AC part would be
+   * lost in the float precision of the large squared DC part.
    */
 
-  float last_value_ = 0.0f;
+  float reference_ = 0.0f;
   float sample_sum_ = 0.0f;
   float sample_squared_sum_ = 0.0f;
   uint32_t num_samples_ = 0;
+  /// Time spent in sample_block() during the sampling phase, in us.
+  uint32_t block_time_us_ = 0;
   bool is_sampling_ = false;
 };
 
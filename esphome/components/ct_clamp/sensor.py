@@ -2,6 +2,7 @@ import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components import sensor, voltage_sampler
 from esphome.const import (
+    CONF_SAMPLE_RATE,
     CONF_SENSOR,
     DEVICE_CLASS_CURRENT,
     STATE_CLASS_MEASUREMENT,
@@ -30,6 +31,9 @@ CONFIG_SCHEMA = (
             cv.Optional(
                 CONF_SAMPLE_DURATION, default="200ms"
             ): cv.positive_time_period_milliseconds,
+            cv.Optional(CONF_SAMPLE_RATE, default="4kHz"): cv.All(
+                cv.frequency, cv.Range(min=1.0, max=100000.0)
+            ),
         }
     )
     .extend(cv.polling_component_schema("60s"))
@@ -43,3 +47,4 @@ async def to_code(config):
     sens = await cg.get_variable(config[CONF_SENSOR])
     cg.add(var.set_source(sens))
     cg.add(var.set_sample_duration(config[CONF_SAMPLE_DURATION]))
+    cg.add(var.set_sample_rate(int(config[CONF_SAMPLE_RATE])))
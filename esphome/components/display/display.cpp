@@ -54,33 +54,34 @@ void Display::line_at_angle(int x, int y, int angle, int start_radius, int stop_
 void Display::draw_pixels_at(int x_start, int y_start, int w, int h, const uint8_t *ptr, ColorOrder order,
                              ColorBitness bitness, bool big_endian, int x_offset, int y_offset, int x_pad) {
   size_t line_stride = x_offset + w + x_pad;  // length of each source line in pixels
-  uint32_t color_value;
+  // Select the decoder once per call rather than once per pixel.
   for (int y = 0; y != h; y++) {
-    size_t source_idx = (y_offset + y) * line_stride + x_offset;
-    size_t source_idx_mod;
-    for (int x = 0; x != w; x++, source_idx++) {
-      switch (bitness) {
-        default:
-          color_value = ptr[source_idx];
-          break;
-        case COLOR_BITNESS_565:
-          source_idx_mod = source_idx * 2;
-          if (big_endian) {
-            color_value = (ptr[source_idx_mod] << 8) + ptr[source_idx_mod + 1];
-          } else {
-            color_value = ptr[source_idx_mod] + (ptr[source_idx_mod + 1] << 8);
-          }
-          break;
-        case COLOR_BITNESS_888:
-          source_idx_mod = source_idx * 3;
-          if (big_endian) {
-            color_value = (ptr[source_idx_mod + 0] << 16) + (ptr[source_idx_mod + 1] << 8) + ptr[source_idx_mod + 2];
-          } else {
-            color_value = ptr[source_idx_mod + 0] + (ptr[source_idx_mod + 1] << 8) + (ptr[source_idx_mod + 2] << 16);
-          }
-          break;
+    const size_t source_idx = (y_offset + y) * line_stride + x_offset;
+    switch (bitness) {
+      default: {
+        const uint8_t *src = ptr + source_idx;
+        for (int x = 0; x != w; x++)
+          this->draw_pixel_at(x + x_start, y + y_start, ColorUtil::to_color(src[x], order, bitness));
+        break;
+      }
+      case COLOR_BITNESS_565: {
+        const uint8_t *src = ptr + source_idx * 2;
+        const int hi = big_endian ? 0 : 1;
+        for (int x = 0; x != w; x++, src += 2) {
+          const uint32_t color_value = (src[hi] << 8) + src[1 - hi];
+          this->draw_pixel_at(x + x_start, y + y_start, ColorUtil::to_color(color_value, order, bitness));
+        }
+        break;
+      }
+      case COLOR_BITNESS_888: {
+        const uint8_t *src = ptr + source_idx * 3;
+        for (int x = 0; x != w; x++, src += 3) {
+          const uint32_t color_value = big_endian ? (src[0] << 16) + (src[1] << 8) + src[2]
+                                                  : src[0] + (src[1] << 8) + (src[2] << 16);
+          this->draw_pixel_at(x + x_start, y + y_start, ColorUtil::to_color(color_value, order, bitness));
+        }
+        break;
       }
-      this->draw_pixel_at(x + x_start, y + y_start, ColorUtil::to_color(color_value, order, bitness));
     }
   }
 }
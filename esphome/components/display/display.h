@@ -653,6 +653,15 @@ class Display : public PollingComponent {
    */
   bool clip(int x, int y);
 
+  /** Clip a rectangle against the display and the active clipping region.
+   *
+   * The visible part spans [min_x, max_x) and [min_y, max_y).
+   * @return false if no part of the rectangle is visible.
+   */
+  bool clip(int x, int y, int w, int h, int &min_x, int &max_x, int &min_y, int &max_y) {
+    return this->clamp_x_(x, w, min_x, max_x) && this->clamp_y_(y, h, min_y, max_y);
+  }
+
   void test_card();
   void show_test_card() { this->show_test_card_ = true; }
 
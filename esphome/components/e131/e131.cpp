@@ -18,7 +18,7 @@ E131Component::~E131Component() {
 }
 
 void E131Component::setup() {
-  this->socket_ = socket::socket_ip(SOCK_DGRAM, IPPROTO_IP);
+  this->socket_ = socket::socket_ip_loop_monitored(SOCK_DGRAM, IPPROTO_IP);
 
   int enable = 1;
   int err = this->socket_->setsockopt(SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(int));
@@ -58,6 +58,9 @@ void E131Component::loop() {
   int universe = 0;
   uint8_t buf[1460];
 
+  if (!this->socket_->ready())
+    return;
+
   ssize_t len = this->socket_->read(buf, sizeof(buf));
   if (len == -1) {
     return;
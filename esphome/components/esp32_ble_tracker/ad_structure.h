@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace esp32_ble_tracker {
+
+/// Service Data - 16 bit UUID, same value as ESP_BLE_AD_TYPE_SERVICE_DATA.
+static const uint8_t AD_TYPE_SERVICE_DATA_16 = 0x16;
+
+/** Call \p callback(type, data, len) for every AD structure in an advertisement or scan response payload.
+ *
+ * The data points into \p payload, nothing is copied or allocated. Zero length structures (padding) are
+ * skipped and iteration stops at the first structure that does not fit into \p len.
+ */
+template<typename F> void for_each_ad_structure(const uint8_t *payload, size_t len, F &&callback) {
+  size_t offset = 0;
+  while (offset + 2 < len) {
+    const uint8_t field_length = payload[offset++];
+    if (field_length == 0)
+      continue;
+    const uint8_t type = payload[offset];
+    if (offset + field_length > len)
+      return;
+    callback(type, &payload[offset + 1], uint8_t(field_length - 1));
+    offset += field_length;
+  }
+}
+
+/// Call \p callback(data, len) with the payload (after the UUID) of every service data structure for the
+/// 16-bit \p uuid.
+template<typename F> void for_each_service_data(const uint8_t *payload, size_t len, uint16_t uuid, F &&callback) {
+  for_each_ad_structure(payload, len, [&](uint8_t type, const uint8_t *data, uint8_t data_len) {
+    if (type == AD_TYPE_SERVICE_DATA_16 && data_len >= 2 && uint16_t(data[0] | (data[1] << 8)) == uuid)
+      callback(data + 2, size_t(data_len - 2));
+  });
+}
+
+/// Store the UUIDs of up to \p max 16-bit service data structures in \p uuids and return how many were found.
+inline size_t get_service_data_uuids(const uint8_t *payload, size_t len, uint16_t *uuids, size_t max) {
+  size_t count = 0;
+  for_each_ad_structure(payload, len, [&](uint8_t type, const uint8_t *data, uint8_t data_len) {
+    if (type == AD_TYPE_SERVICE_DATA_16 && data_len >= 2 && count < max)
+      uuids[count++] = uint16_t(data[0] | (data[1] << 8));
+  });
+  return count;
+}
+
+}  // namespace esp32_ble_tracker
+}  // namespace esphome
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace esphome {
+namespace esp32_ble_tracker {
+
+/** Index of advertisement listeners by MAC address and 16-bit service data UUID.
+ *
+ * A listener is stored in exactly one bucket: its address if it has one, otherwise its service data UUID,
+ * otherwise the list of listeners that receive every advertisement. Dispatching an advertisement only visits
+ * the matching buckets instead of every registered listener.
+ *
+ * Kept free of any ESP-IDF types so it can be compiled and benchmarked on the host.
+ */
+template<typename T> class AdvertisementDispatcher {
+ public:
+  /// Register \p listener. An address or UUID of 0 means the listener does not filter on it.
+  void add(T *listener, uint64_t address, uint16_t service_data_uuid) {
+    if (address != 0) {
+      this->by_address_[address].push_back(listener);
+    } else if (service_data_uuid != 0) {
+      this->by_service_data_uuid_[service_data_uuid].push_back(listener);
+    } else {
+      this->unfiltered_.push_back(listener);
+    }
+  }
+
+  void clear() {
+    this->by_address_.clear();
+    this->by_service_data_uuid_.clear();
+    this->unfiltered_.clear();
+  }
+
+  /** Call \p callback for every listener that may be interested in an advertisement.
+   *
+   * @param address The advertiser's address.
+   * @param uuids The 16-bit UUIDs of the advertisement's service data, may contain duplicates.
+   * @param uuid_count Number of entries in \p uuids.
+   * @param callback Invoked once per matching listener.
+   */
+  template<typename F> void dispatch(uint64_t address, const uint16_t *uuids, size_t uuid_count, F &&callback) const {
+    if (!this->by_address_.empty()) {
+      auto it = this->by_address_.find(address);
+      if (it != this->by_address_.end()) {
+        for (T *listener : it->second)
+          callback(listener);
+      }
+    }
+    if (!this->by_service_data_uuid_.empty()) {
+      for (size_t i = 0; i < uuid_count; i++) {
+        bool seen = false;
+        for (size_t j = 0; j < i && !seen; j++)
+          seen = uuids[j] == uuids[i];
+        if (seen)
+          continue;
+        auto it = this->by_service_data_uuid_.find(uuids[i]);
+        if (it != this->by_service_data_uuid_.end()) {
+          for (T *listener : it->second)
+            callback(listener);
+        }
+      }
+    }
+    for (T *listener : this->unfiltered_)
+      callback(listener);
+  }
+
+ protected:
+  std::unordered_map<uint64_t, std::vector<T *>> by_address_;
+  std::unordered_map<uint16_t, std::vector<T *>> by_service_data_uuid_;
+  std::vector<T *> unfiltered_;
+};
+
+}  // namespace esp32_ble_tracker
+}  // namespace esphome
@@ -135,15 +135,29 @@ void ESP32BLETracker::loop() {
       }
 
       if (this->parse_advertisements_) {
+        if (this->dispatcher_dirty_) {
+          this->dispatcher_.clear();
+          for (auto *listener : this->listeners_) {
+            if (listener->get_advertisement_parser_type() == AdvertisementParserType::PARSED_ADVERTISEMENTS) {
+              this->dispatcher_.add(listener, listener->get_address_filter(),
+                                    listener->get_service_data_uuid_filter());
+            }
+          }
+          this->dispatcher_dirty_ = false;
+        }
         for (size_t i = 0; i < index; i++) {
           ESPBTDevice device;
           device.parse_scan_rst(this->scan_result_buffer_[i]);
 
+          const auto &scan_result = this->scan_result_buffer_[i];
+          uint16_t uuids[8];
+          size_t uuid_count = get_service_data_uuids(
+              scan_result.ble_adv, scan_result.adv_data_len + scan_result.scan_rsp_len, uuids, 8);
           bool found = false;
-          for (auto *listener : this->listeners_) {
+          this->dispatcher_.dispatch(device.address_uint64(), uuids, uuid_count, [&](ESPBTDeviceListener *listener) {
             if (listener->parse_device(device))
               found = true;
-          }
+          });
 
           for (auto *client : this->clients_) {
             if (client->parse_device(device)) {
@@ -340,6 +354,7 @@ void ESP32BLETracker::register_listener(ESPBTDeviceListener *listener) {
 }
 
 void ESP32BLETracker::recalculate_advertisement_parser_types() {
+  this->dispatcher_dirty_ = true;
   this->raw_advertisements_ = false;
   this->parse_advertisements_ = false;
   for (auto *listener : this->listeners_) {
@@ -444,9 +459,10 @@ void ESPBTDevice::parse_scan_rst(const esp_ble_gap_cb_param_t::ble_scan_result_e
     this->address_[i] = param.bda[i];
   this->address_type_ = param.ble_addr_type;
   this->rssi_ = param.rssi;
-  this->parse_adv_(param);
+  this->adv_parsed_ = false;
 
 #ifdef ESPHOME_LOG_HAS_VERY_VERBOSE
+  this->parse_adv_();
   ESP_LOGVV(TAG, "Parse Result:");
   const char *address_type;
   switch (this->address_type_) {
@@ -505,23 +521,14 @@ void ESPBTDevice::parse_scan_rst(const esp_ble_gap_cb_param_t::ble_scan_result_e
   ESP_LOGVV(TAG, "  Adv data: %s", format_hex_pretty(param.ble_adv, param.adv_data_len + param.scan_rsp_len).c_str());
 #endif
 }
-void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param) {
-  size_t offset = 0;
-  const uint8_t *payload = param.ble_adv;
-  uint8_t len = param.adv_data_len + param.scan_rsp_len;
-
-  while (offset + 2 < len) {
-    const uint8_t field_length = payload[offset++];  // First byte is length of adv record
-    if (field_length == 0) {
-      continue;  // Possible zero padded advertisement data
-    }
-
-    // first byte of adv record is adv record type
-    const uint8_t record_type = payload[offset++];
-    const uint8_t *record = &payload[offset];
-    const uint8_t record_length = field_length - 1;
-    offset += record_length;
+void ESPBTDevice::parse_adv_() const {
+  if (this->adv_parsed_)
+    return;
+  this->adv_parsed_ = true;
+  const uint8_t *payload = this->scan_result_.ble_adv;
+  size_t len = this->scan_result_.adv_data_len + this->scan_result_.scan_rsp_len;
 
+  for_each_ad_structure(payload, len, [this](uint8_t record_type, const uint8_t *record, uint8_t record_length) {
     // See also Generic Access Profile Assigned Numbers:
     // https://www.bluetooth.com/specifications/assigned-numbers/generic-access-profile/ See also ADVERTISING AND SCAN
     // RESPONSE DATA FORMAT: https://www.bluetooth.com/specifications/bluetooth-core-specification/ (vol 3, part C, 11)
@@ -546,7 +553,7 @@ void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_p
         // CSS 1.5 TX POWER LEVEL
         // "The TX Power Level data type indicates the transmitted power level of the packet containing the data type."
         // CSS 1: Optional in this context (may appear more than once in a block).
-        this->tx_powers_.push_back(*payload);
+        this->tx_powers_.push_back(*record);
         break;
       }
       case ESP_BLE_AD_TYPE_APPEARANCE: {
@@ -663,7 +670,7 @@ void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_p
         break;
       }
     }
-  }
+  });
 }
 std::string ESPBTDevice::address_str() const {
   char mac[24];
@@ -21,6 +21,9 @@
 #include "esphome/components/esp32_ble/ble.h"
 #include "esphome/components/esp32_ble/ble_uuid.h"
 
+#include "ad_structure.h"
+#include "advertisement_dispatcher.h"
+
 namespace esphome {
 namespace esp32_ble_tracker {
 
@@ -60,6 +63,12 @@ class ESPBLEiBeacon {
   } PACKED beacon_data_;
 };
 
+/** A parsed scan result.
+ *
+ * Only the address and RSSI are extracted up front. The AD structures are parsed into the vectors below the
+ * first time one of their getters is called, so advertisements nobody is interested in never allocate.
+ * for_each_service_data() reads the raw payload without parsing at all.
+ */
 class ESPBTDevice {
  public:
   void parse_scan_rst(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param);
@@ -72,24 +81,53 @@ class ESPBTDevice {
 
   esp_ble_addr_type_t get_address_type() const { return this->address_type_; }
   int get_rssi() const { return rssi_; }
-  const std::string &get_name() const { return this->name_; }
+  const std::string &get_name() const {
+    this->parse_adv_();
+    return this->name_;
+  }
 
-  const std::vector<int8_t> &get_tx_powers() const { return tx_powers_; }
+  const std::vector<int8_t> &get_tx_powers() const {
+    this->parse_adv_();
+    return tx_powers_;
+  }
+
+  const optional<uint16_t> &get_appearance() const {
+    this->parse_adv_();
+    return appearance_;
+  }
+  const optional<uint8_t> &get_ad_flag() const {
+    this->parse_adv_();
+    return ad_flag_;
+  }
+  const std::vector<ESPBTUUID> &get_service_uuids() const {
+    this->parse_adv_();
+    return service_uuids_;
+  }
 
-  const optional<uint16_t> &get_appearance() const { return appearance_; }
-  const optional<uint8_t> &get_ad_flag() const { return ad_flag_; }
-  const std::vector<ESPBTUUID> &get_service_uuids() const { return service_uuids_; }
+  const std::vector<ServiceData> &get_manufacturer_datas() const {
+    this->parse_adv_();
+    return manufacturer_datas_;
+  }
 
-  const std::vector<ServiceData> &get_manufacturer_datas() const { return manufacturer_datas_; }
+  const std::vector<ServiceData> &get_service_datas() const {
+    this->parse_adv_();
+    return service_datas_;
+  }
 
-  const std::vector<ServiceData> &get_service_datas() const { return service_datas_; }
+  /// Call \p callback(data, len) for every service data payload with the 16-bit \p uuid, without parsing or
+  /// copying the advertisement.
+  template<typename F> void for_each_service_data(uint16_t uuid, F &&callback) const {
+    esp32_ble_tracker::for_each_service_data(this->scan_result_.ble_adv,
+                                             this->scan_result_.adv_data_len + this->scan_result_.scan_rsp_len, uuid,
+                                             callback);
+  }
 
   const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &get_scan_result() const { return scan_result_; }
 
   bool resolve_irk(const uint8_t *irk) const;
 
   optional<ESPBLEiBeacon> get_ibeacon() const {
-    for (auto &it : this->manufacturer_datas_) {
+    for (auto &it : this->get_manufacturer_datas()) {
       auto res = ESPBLEiBeacon::from_manufacturer_data(it);
       if (res.has_value())
         return *res;
@@ -98,20 +136,22 @@ class ESPBTDevice {
   }
 
  protected:
-  void parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param);
+  /// Fill the AD structure fields from scan_result_, once.
+  void parse_adv_() const;
 
   esp_bd_addr_t address_{
       0,
   };
   esp_ble_addr_type_t address_type_{BLE_ADDR_TYPE_PUBLIC};
   int rssi_{0};
-  std::string name_{};
-  std::vector<int8_t> tx_powers_{};
-  optional<uint16_t> appearance_{};
-  optional<uint8_t> ad_flag_{};
-  std::vector<ESPBTUUID> service_uuids_{};
-  std::vector<ServiceData> manufacturer_datas_{};
-  std::vector<ServiceData> service_datas_{};
+  mutable bool adv_parsed_{false};
+  mutable std::string name_{};
+  mutable std::vector<int8_t> tx_powers_{};
+  mutable optional<uint16_t> appearance_{};
+  mutable optional<uint8_t> ad_flag_{};
+  mutable std::vector<ESPBTUUID> service_uuids_{};
+  mutable std::vector<ServiceData> manufacturer_datas_{};
+  mutable std::vector<ServiceData> service_datas_{};
   esp_ble_gap_cb_param_t::ble_scan_result_evt_param scan_result_{};
 };
 
@@ -127,6 +167,11 @@ class ESPBTDeviceListener {
   virtual AdvertisementParserType get_advertisement_parser_type() {
     return AdvertisementParserType::PARSED_ADVERTISEMENTS;
   };
+  /// Only pass advertisements from this address to parse_device(), 0 for all addresses.
+  virtual uint64_t get_address_filter() const { return 0; }
+  /// Only pass advertisements with service data for this 16-bit UUID to parse_device(), 0 for any.
+  /// Ignored if get_address_filter() is set.
+  virtual uint16_t get_service_data_uuid_filter() const { return 0; }
   void set_parent(ESP32BLETracker *parent) { parent_ = parent; }
 
  protected:
@@ -234,6 +279,10 @@ class ESP32BLETracker : public Component,
   /// Vector of addresses that have already been printed in print_bt_device_info
   std::vector<uint64_t> already_discovered_;
   std::vector<ESPBTDeviceListener *> listeners_;
+  /// Index of the listeners_ that want parsed advertisements, rebuilt on the next advertisement after
+  /// recalculate_advertisement_parser_types() (filters are usually configured after registration).
+  AdvertisementDispatcher<ESPBTDeviceListener> dispatcher_;
+  bool dispatcher_dirty_{true};
   /// Client parameters.
   std::vector<ESPBTClient *> clients_;
   /// A structure holding the ESP BLE scan parameters.
@@ -26,7 +26,9 @@ class Event : public EntityBase, public EntityBase_DeviceClass {
   void trigger(const std::string &event_type);
   void set_event_types(const std::set<std::string> &event_types) { this->types_ = event_types; }
   std::set<std::string> get_event_types() const { return this->types_; }
-  void add_on_event_callback(std::function<void(const std::string &event_type)> &&callback);
+  template<typename F> void add_on_event_callback(F &&callback) {
+    this->event_callback_.add(std::forward<F>(callback));
+  }
 
  protected:
   CallbackManager<void(const std::string &event_type)> event_callback_;
@@ -46,6 +46,8 @@ void GT911Touchscreen::setup() {
 
   // check the configuration of the int line.
   uint8_t data[4];
+  // each register is selected with a write and read with a separate transfer, keep other transactions out in between
+  i2c::I2CBusLock lock(this->bus_);
   err = this->write(GET_SWITCHES, 2);
   if (err == i2c::ERROR_OK) {
     err = this->read(data, 1);
@@ -88,6 +90,7 @@ void GT911Touchscreen::update_touches() {
   i2c::ErrorCode err;
   uint8_t touch_state = 0;
   uint8_t data[MAX_TOUCHES + 1][8];  // 8 bytes each for each point, plus extra space for the key byte
+  i2c::I2CBusLock lock(this->bus_);
 
   err = this->write(GET_TOUCH_STATE, sizeof(GET_TOUCH_STATE), false);
   ERROR_CHECK(err);
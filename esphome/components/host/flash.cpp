@@ -0,0 +1,112 @@
+#ifdef USE_HOST
+
+#include "flash.h"
+#include "esphome/core/log.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace host {
+
+static const char *const TAG = "host.flash";
+
+HostFlash::HostFlash(size_t sector_size, size_t sector_count)
+    : sector_size_(sector_size),
+      sector_count_(sector_count),
+      image_(sector_size * sector_count, 0xFF),
+      erase_counts_(sector_count, 0) {}
+
+HostFlash::~HostFlash() {
+  if (this->file_ != nullptr)
+    fclose(this->file_);
+}
+
+bool HostFlash::open(const std::string &filename) {
+  this->file_ = fopen(filename.c_str(), "r+b");
+  if (this->file_ != nullptr) {
+    size_t read = fread(this->image_.data(), 1, this->image_.size(), this->file_);
+    if (read != this->image_.size())
+      ESP_LOGW(TAG, "Flash image %s is truncated (%zu/%zu bytes)", filename.c_str(), read, this->image_.size());
+    return true;
+  }
+  this->file_ = fopen(filename.c_str(), "w+b");
+  if (this->file_ == nullptr) {
+    ESP_LOGE(TAG, "Could not create flash image %s", filename.c_str());
+    return false;
+  }
+  this->persist_(0, this->image_.size());
+  return true;
+}
+
+void HostFlash::persist_(size_t address, size_t len) {
+  if (this->file_ == nullptr)
+    return;
+  fseek(this->file_, address, SEEK_SET);
+  fwrite(this->image_.data() + address, 1, len, this->file_);
+  fflush(this->file_);
+}
+
+bool HostFlash::read(size_t address, uint8_t *data, size_t len) {
+  if (address + len > this->image_.size())
+    return false;
+  if (len != 0)
+    memcpy(data, this->image_.data() + address, len);
+  return true;
+}
+
+bool HostFlash::write(size_t address, const uint8_t *data, size_t len) {
+  if (address + len > this->image_.size())
+    return false;
+  for (size_t i = 0; i < len; i++) {
+    if ((this->image_[address + i] & data[i]) != data[i]) {
+      ESP_LOGE(TAG, "Write to 0x%06zX sets bits that are not erased", address + i);
+      return false;
+    }
+  }
+  size_t applied = len;
+  if (this->write_budget_ >= 0) {
+    applied = std::min<size_t>(len, this->write_budget_);
+    this->write_budget_ -= applied;
+  }
+  for (size_t i = 0; i < applied; i++)
+    this->image_[address + i] = data[i];
+  this->persist_(address, applied);
+  this->write_count_++;
+  this->bytes_written_ += applied;
+  return applied == len;
+}
+
+bool HostFlash::erase_sector(size_t sector) {
+  if (sector >= this->sector_count_)
+    return false;
+  if (this->write_budget_ >= 0) {
+    // An interrupted erase leaves the sector contents undefined; keep the old data so the next scan sees garbage.
+    if (size_t(this->write_budget_) < this->sector_size_) {
+      this->write_budget_ = 0;
+      return false;
+    }
+    this->write_budget_ -= this->sector_size_;
+  }
+  const size_t address = sector * this->sector_size_;
+  std::fill_n(this->image_.begin() + address, this->sector_size_, 0xFF);
+  this->persist_(address, this->sector_size_);
+  this->erase_counts_[sector]++;
+  return true;
+}
+
+uint32_t HostFlash::get_total_erases() const {
+  uint32_t total = 0;
+  for (uint32_t count : this->erase_counts_)
+    total += count;
+  return total;
+}
+
+uint32_t HostFlash::get_max_erases() const {
+  return *std::max_element(this->erase_counts_.begin(), this->erase_counts_.end());
+}
+
+}  // namespace host
+}  // namespace esphome
+
+#endif  // USE_HOST
@@ -0,0 +1,59 @@
+#pragma once
+
+#ifdef USE_HOST
+
+#include "esphome/components/preferences/preference_log.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace esphome {
+namespace host {
+
+/** File backed flash simulation with NOR semantics.
+ *
+ * The image is kept in memory and mirrored to a file. Writes that would set a bit back to 1 are rejected, and
+ * every erase/write is counted per sector so that wear can be inspected. A write budget can be set to emulate a
+ * power loss: once it runs out, the pending write is only partially applied and all further operations fail.
+ */
+class HostFlash : public preferences::PreferenceFlash {
+ public:
+  HostFlash(size_t sector_size, size_t sector_count);
+  ~HostFlash();
+
+  /// Attach a backing file, loading it if it exists. Without a file the flash only lives in memory.
+  bool open(const std::string &filename);
+
+  size_t get_sector_size() const override { return this->sector_size_; }
+  size_t get_sector_count() const override { return this->sector_count_; }
+  bool read(size_t address, uint8_t *data, size_t len) override;
+  bool write(size_t address, const uint8_t *data, size_t len) override;
+  bool erase_sector(size_t sector) override;
+
+  /// Fail after \p bytes more bytes have been written (erases count as a full sector), negative to disable.
+  void set_write_budget(int32_t bytes) { this->write_budget_ = bytes; }
+
+  uint32_t get_erase_count(size_t sector) const { return this->erase_counts_[sector]; }
+  uint32_t get_total_erases() const;
+  uint32_t get_max_erases() const;
+  uint32_t get_write_count() const { return this->write_count_; }
+  uint32_t get_bytes_written() const { return this->bytes_written_; }
+
+ protected:
+  void persist_(size_t address, size_t len);
+
+  size_t sector_size_;
+  size_t sector_count_;
+  std::vector<uint8_t> image_;
+  std::vector<uint32_t> erase_counts_;
+  FILE *file_{nullptr};
+  int32_t write_budget_{-1};
+  uint32_t write_count_{0};
+  uint32_t bytes_written_{0};
+};
+
+}  // namespace host
+}  // namespace esphome
+
+#endif  // USE_HOST
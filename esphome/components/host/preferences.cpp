@@ -1,9 +1,10 @@
 #ifdef USE_HOST
 
 #include <filesystem>
-#include <fstream>
+#include <cinttypes>
 #include "preferences.h"
 #include "esphome/core/application.h"
+#include "esphome/core/log.h"
 
 namespace esphome {
 namespace host {
@@ -14,51 +15,67 @@ static const char *const TAG = "host.preferences";
 void HostPreferences::setup_() {
   if (this->setup_complete_)
     return;
-  this->filename_.append(getenv("HOME"));
-  this->filename_.append("/.esphome");
-  this->filename_.append("/prefs");
-  fs::create_directories(this->filename_);
-  this->filename_.append("/");
-  this->filename_.append(App.get_name());
-  this->filename_.append(".prefs");
-  FILE *fp = fopen(this->filename_.c_str(), "rb");
-  if (fp != nullptr) {
-    while (!feof((fp))) {
-      uint32_t key;
-      uint8_t len;
-      if (fread(&key, sizeof(key), 1, fp) != 1)
-        break;
-      if (fread(&len, sizeof(len), 1, fp) != 1)
-        break;
-      uint8_t data[len];
-      if (fread(data, sizeof(uint8_t), len, fp) != len)
-        break;
-      std::vector vec(data, data + len);
-      this->data[key] = vec;
-    }
-    fclose(fp);
-  }
   this->setup_complete_ = true;
+  std::string path;
+  path.append(getenv("HOME"));
+  path.append("/.esphome");
+  path.append("/prefs");
+  fs::create_directories(path);
+  path.append("/");
+  path.append(App.get_name());
+  const std::string legacy = path + ".prefs";
+  const std::string image = path + ".flash";
+  const bool fresh = !fs::exists(image);
+  if (!this->flash_.open(image) || !this->log_.open()) {
+    ESP_LOGE(TAG, "Could not open preference storage %s", image.c_str());
+    return;
+  }
+  if (fresh && fs::exists(legacy))
+    this->import_legacy_(legacy);
+}
+
+void HostPreferences::import_legacy_(const std::string &filename) {
+  FILE *fp = fopen(filename.c_str(), "rb");
+  if (fp == nullptr)
+    return;
+  while (!feof((fp))) {
+    uint32_t key;
+    uint8_t len;
+    if (fread(&key, sizeof(key), 1, fp) != 1)
+      break;
+    if (fread(&len, sizeof(len), 1, fp) != 1)
+      break;
+    uint8_t data[len];
+    if (fread(data, sizeof(uint8_t), len, fp) != len)
+      break;
+    this->log_.write(key, data, len);
+  }
+  fclose(fp);
+  ESP_LOGI(TAG, "Imported %zu preferences from %s", this->log_.get_entry_count(), filename.c_str());
 }
 
 bool HostPreferences::sync() {
   this->setup_();
-  FILE *fp = fopen(this->filename_.c_str(), "wb");
-  std::map<uint32_t, std::vector<uint8_t>>::iterator it;
-
-  for (it = this->data.begin(); it != this->data.end(); ++it) {
-    fwrite(&it->first, sizeof(uint32_t), 1, fp);
-    uint8_t len = it->second.size();
-    fwrite(&len, sizeof(len), 1, fp);
-    fwrite(it->second.data(), sizeof(uint8_t), it->second.size(), fp);
+  bool ok = true;
+  const uint32_t written = this->log_.get_records_written();
+  [[maybe_unused]] const uint32_t erases = this->flash_.get_total_erases();
+  for (auto &it : this->pending_) {
+    if (!this->log_.write(it.first, it.second.data(), it.second.size()))
+      ok = false;
   }
-  fclose(fp);
-  return true;
+  this->pending_.clear();
+  if (this->log_.get_records_written() != written) {
+    ESP_LOGD(TAG, "Synced: %" PRIu32 " records written, %" PRIu32 " sectors erased (max %" PRIu32 " per sector)",
+             this->log_.get_records_written() - written, this->flash_.get_total_erases() - erases,
+             this->flash_.get_max_erases());
+  }
+  return ok;
 }
 
 bool HostPreferences::reset() {
-  host_preferences->data.clear();
-  return true;
+  this->setup_();
+  this->pending_.clear();
+  return this->log_.format();
 }
 
 ESPPreferenceObject HostPreferences::make_preference(size_t length, uint32_t type, bool in_flash) {
@@ -2,8 +2,13 @@
 
 #ifdef USE_HOST
 
+#include "esphome/components/preferences/preference_log.h"
 #include "esphome/core/preferences.h"
+#include "flash.h"
+#include <cstring>
 #include <map>
+#include <string>
+#include <vector>
 
 namespace esphome {
 namespace host {
@@ -30,32 +35,33 @@ class HostPreferences : public ESPPreferences {
   }
 
   bool save(uint32_t key, const uint8_t *data, size_t len) {
-    if (len > 255)
-      return false;
     this->setup_();
-    std::vector vec(data, data + len);
-    this->data[key] = vec;
+    this->pending_[key].assign(data, data + len);
     return true;
   }
 
   bool load(uint32_t key, uint8_t *data, size_t len) {
-    if (len > 255)
-      return false;
     this->setup_();
-    if (this->data.count(key) == 0)
+    auto it = this->pending_.find(key);
+    if (it == this->pending_.end())
+      return this->log_.load(key, data, len);
+    if (it->second.size() != len)
       return false;
-    auto vec = this->data[key];
-    if (vec.size() != len)
-      return false;
-    memcpy(data, vec.data(), len);
+    memcpy(data, it->second.data(), len);
     return true;
   }
 
+  const HostFlash &get_flash() const { return this->flash_; }
+  const preferences::PreferenceLog &get_log() const { return this->log_; }
+
  protected:
   void setup_();
+  void import_legacy_(const std::string &filename);
   bool setup_complete_{};
-  std::string filename_{};
-  std::map<uint32_t, std::vector<uint8_t>> data{};
+  HostFlash flash_{16 * 1024, 4};
+  preferences::PreferenceLog log_{&this->flash_};
+  /// Saves since the last sync, only the latest value per key is written to flash.
+  std::map<uint32_t, std::vector<uint8_t>> pending_{};
 };
 void setup_preferences();
 extern HostPreferences *host_preferences;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
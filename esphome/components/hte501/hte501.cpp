@@ -9,6 +9,7 @@ static const char *const TAG = "hte501";
 void HTE501Component::setup() {
   ESP_LOGCONFIG(TAG, "Setting up HTE501...");
   uint8_t address[] = {0x70, 0x29};
+  i2c::I2CBusLock lock(this->bus_);
   this->write(address, 2, false);
   uint8_t identification[9];
   this->read(identification, 9);
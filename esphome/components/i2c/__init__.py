@@ -25,10 +25,13 @@ I2CBus = i2c_ns.class_("I2CBus")
 ArduinoI2CBus = i2c_ns.class_("ArduinoI2CBus", I2CBus, cg.Component)
 IDFI2CBus = i2c_ns.class_("IDFI2CBus", I2CBus, cg.Component)
 I2CDevice = i2c_ns.class_("I2CDevice")
+I2CTransactionQueue = i2c_ns.class_("I2CTransactionQueue", cg.Component)
 
 
 CONF_SDA_PULLUP_ENABLED = "sda_pullup_enabled"
 CONF_SCL_PULLUP_ENABLED = "scl_pullup_enabled"
+CONF_TRANSACTION_QUEUE = "transaction_queue"
+CONF_TRANSACTION_QUEUE_ID = "transaction_queue_id"
 MULTI_CONF = True
 
 
@@ -62,6 +65,10 @@ CONFIG_SCHEMA = cv.All(
             ),
             cv.Optional(CONF_TIMEOUT): cv.positive_time_period,
             cv.Optional(CONF_SCAN, default=True): cv.boolean,
+            cv.Optional(CONF_TRANSACTION_QUEUE, default=False): cv.boolean,
+            cv.GenerateID(CONF_TRANSACTION_QUEUE_ID): cv.declare_id(
+                I2CTransactionQueue
+            ),
         }
     ).extend(cv.COMPONENT_SCHEMA),
     cv.only_on([PLATFORM_ESP32, PLATFORM_ESP8266, PLATFORM_RP2040]),
@@ -85,6 +92,10 @@ async def to_code(config):
     cg.add(var.set_scan(config[CONF_SCAN]))
     if CONF_TIMEOUT in config:
         cg.add(var.set_timeout(int(config[CONF_TIMEOUT].total_microseconds)))
+    if config[CONF_TRANSACTION_QUEUE]:
+        queue = cg.new_Pvariable(config[CONF_TRANSACTION_QUEUE_ID])
+        await cg.register_component(queue, {})
+        cg.add(queue.set_bus(var))
     if CORE.using_arduino:
         cg.add_library("Wire", None)
 
@@ -7,7 +7,9 @@ namespace i2c {
 
 static const char *const TAG = "i2c";
 
+// A register read is a write followed by a separate read, the lock keeps queued transactions out of the gap.
 ErrorCode I2CDevice::read_register(uint8_t a_register, uint8_t *data, size_t len, bool stop) {
+  I2CBusLock lock(bus_);
   ErrorCode err = this->write(&a_register, 1, stop);
   if (err != ERROR_OK)
     return err;
@@ -16,6 +18,7 @@ ErrorCode I2CDevice::read_register(uint8_t a_register, uint8_t *data, size_t len
 
 ErrorCode I2CDevice::read_register16(uint16_t a_register, uint8_t *data, size_t len, bool stop) {
   a_register = convert_big_endian(a_register);
+  I2CBusLock lock(bus_);
   ErrorCode const err = this->write(reinterpret_cast<const uint8_t *>(&a_register), 2, stop);
   if (err != ERROR_OK)
     return err;
@@ -41,6 +44,17 @@ ErrorCode I2CDevice::write_register16(uint16_t a_register, const uint8_t *data,
   return bus_->writev(address_, buffers, 2, stop);
 }
 
+void I2CDevice::submit(std::vector<I2CTransfer> &&transfers, I2CCallback &&callback) {
+  I2CTransactionQueue *queue = bus_->get_transaction_queue();
+  if (queue != nullptr) {
+    queue->submit(address_, std::move(transfers), std::move(callback));
+    return;
+  }
+  std::vector<uint8_t> result;
+  ErrorCode err = I2CTransactionQueue::execute(bus_, address_, transfers, result);
+  callback(err, result);
+}
+
 bool I2CDevice::read_bytes_16(uint8_t a_register, uint16_t *data, uint8_t len) {
   if (read_register(a_register, reinterpret_cast<uint8_t *>(data), len * 2) != ERROR_OK)
     return false;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "i2c_bus.h"
+#include "i2c_transaction_queue.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/optional.h"
 #include <array>
@@ -143,6 +144,12 @@ class I2CDevice {
   /// @param bus pointer to the I2CBus object
   void set_i2c_bus(I2CBus *bus) { bus_ = bus; }
 
+  /// @brief executes a batch of transfers without blocking the caller, if the bus has a transaction queue
+  /// @param transfers the transfers to execute back to back
+  /// @param callback called from the main loop with the result and the bytes of all reads. Without a transaction
+  /// queue the transfers are executed and the callback is called before this method returns.
+  void submit(std::vector<I2CTransfer> &&transfers, I2CCallback &&callback);
+
   /// @brief calls the I2CRegister constructor
   /// @param a_register address of the I²C register
   /// @return an I2CRegister proxy object
@@ -1,12 +1,33 @@
 #pragma once
 #include <cstdint>
 #include <cstddef>
+#include <memory>
 #include <utility>
 #include <vector>
 
+#include "esphome/core/defines.h"
+#include "esphome/core/helpers.h"
+
+#ifdef USE_ESP32
+#include <mutex>
+#endif
+
 namespace esphome {
 namespace i2c {
 
+class I2CTransactionQueue;
+
+#ifdef USE_ESP32
+/// Recursive, so that a component holding the bus lock across several transfers can still call readv()/writev().
+using I2CMutex = std::recursive_mutex;
+#else
+/// Transfers are only executed from the main loop on these platforms, there is nothing to lock.
+struct I2CMutex {
+  void lock() {}
+  void unlock() {}
+};
+#endif
+
 /// @brief Error codes returned by I2CBus and I2CDevice methods
 enum ErrorCode {
   NO_ERROR = 0,                ///< No error found during execution of method
@@ -51,13 +72,12 @@ class I2CBus {
     return readv(address, &buf, 1);
   }
 
-  /// @brief This virtual method reads bytes from an I2CBus into an array of ReadBuffer.
+  /// @brief Reads bytes from an I2CBus into an array of ReadBuffer, holding the bus lock.
   /// @param address address of the I²C component on the i2c bus
   /// @param buffers pointer to an array of ReadBuffer
   /// @param count number of ReadBuffer to read
   /// @return an i2c::ErrorCode
-  /// @details This is a pure virtual method that must be implemented in a subclass.
-  virtual ErrorCode readv(uint8_t address, ReadBuffer *buffers, size_t count) = 0;
+  ErrorCode readv(uint8_t address, ReadBuffer *buffers, size_t count);
 
   virtual ErrorCode write(uint8_t address, const uint8_t *buffer, size_t len) {
     return write(address, buffer, len, true);
@@ -81,17 +101,40 @@ class I2CBus {
     return writev(address, buffers, cnt, true);
   }
 
-  /// @brief This virtual method writes bytes to an I2CBus from an array of WriteBuffer.
+  /// @brief Writes bytes to an I2CBus from an array of WriteBuffer, holding the bus lock.
   /// @param address address of the I²C component on the i2c bus
   /// @param buffers pointer to an array of WriteBuffer
   /// @param count number of WriteBuffer to write
   /// @param stop true or false: True will send a stop message, releasing the bus after
   /// transmission. False will send a restart, keeping the connection active.
   /// @return an i2c::ErrorCode
-  /// @details This is a pure virtual method that must be implemented in the subclass.
-  virtual ErrorCode writev(uint8_t address, WriteBuffer *buffers, size_t count, bool stop) = 0;
+  ErrorCode writev(uint8_t address, WriteBuffer *buffers, size_t count, bool stop);
+
+  /// @brief The transaction queue of this bus, nullptr if it has none.
+  I2CTransactionQueue *get_transaction_queue() const { return this->transaction_queue_; }
+  /// @brief Attach a transaction queue. Since the queue may execute transactions on another task, every transfer
+  /// from then on holds the bus lock.
+  void set_transaction_queue(I2CTransactionQueue *queue) {
+    this->transaction_queue_ = queue;
+    this->enable_lock();
+  }
+  /// @brief Make every transfer on this bus hold a lock from now on, needed once it is used from more than one task.
+  virtual void enable_lock() {
+    if (this->lock_ == nullptr)
+      this->lock_ = make_unique<I2CMutex>();
+  }
+  /// @brief The bus lock, nullptr if the bus is only ever used from the main loop. Buses that are reached through
+  /// another bus (e.g. multiplexer channels) share the lock of that bus.
+  virtual I2CMutex *get_lock() const { return this->lock_.get(); }
 
  protected:
+  /// @brief Reads bytes into an array of ReadBuffer, called by readv() with the bus lock held.
+  /// @details This is a pure virtual method that must be implemented in a subclass.
+  virtual ErrorCode readv_impl(uint8_t address, ReadBuffer *buffers, size_t count) = 0;
+  /// @brief Writes bytes from an array of WriteBuffer, called by writev() with the bus lock held.
+  /// @details This is a pure virtual method that must be implemented in a subclass.
+  virtual ErrorCode writev_impl(uint8_t address, WriteBuffer *buffers, size_t count, bool stop) = 0;
+
   /// @brief Scans the I2C bus for devices. Devices presence is kept in an array of std::pair
   /// that contains the address and the corresponding bool presence flag.
   void i2c_scan_() {
@@ -106,7 +149,40 @@ class I2CBus {
   }
   std::vector<std::pair<uint8_t, bool>> scan_results_;  ///< array containing scan results
   bool scan_{false};                                    ///< Should we scan ? Can be set in the yaml
+  I2CTransactionQueue *transaction_queue_{nullptr};
+  std::unique_ptr<I2CMutex> lock_;
+};
+
+/// @brief Holds the lock of an I2CBus, if it has one, for the lifetime of this object.
+/// @details Every single transfer already holds the lock. Components that split one exchange into several
+/// transfers (e.g. a write followed by a separate read) hold an I2CBusLock around them, so that the transactions
+/// of an I2CTransactionQueue executed on another task cannot get in between.
+class I2CBusLock {
+ public:
+  explicit I2CBusLock(I2CBus *bus) : lock_(bus->get_lock()) {
+    if (this->lock_ != nullptr)
+      this->lock_->lock();
+  }
+  ~I2CBusLock() {
+    if (this->lock_ != nullptr)
+      this->lock_->unlock();
+  }
+  I2CBusLock(const I2CBusLock &) = delete;
+  I2CBusLock &operator=(const I2CBusLock &) = delete;
+
+ protected:
+  I2CMutex *lock_;
 };
 
+inline ErrorCode I2CBus::readv(uint8_t address, ReadBuffer *buffers, size_t count) {
+  I2CBusLock lock(this);
+  return this->readv_impl(address, buffers, count);
+}
+
+inline ErrorCode I2CBus::writev(uint8_t address, WriteBuffer *buffers, size_t count, bool stop) {
+  I2CBusLock lock(this);
+  return this->writev_impl(address, buffers, count, stop);
+}
+
 }  // namespace i2c
 }  // namespace esphome
@@ -108,7 +108,7 @@ void ArduinoI2CBus::dump_config() {
   }
 }
 
-ErrorCode ArduinoI2CBus::readv(uint8_t address, ReadBuffer *buffers, size_t cnt) {
+ErrorCode ArduinoI2CBus::readv_impl(uint8_t address, ReadBuffer *buffers, size_t cnt) {
 #if defined(USE_ESP8266)
   this->set_pins_and_clock_();  // reconfigure Wire global state in case there are multiple instances
 #endif
@@ -150,7 +150,7 @@ ErrorCode ArduinoI2CBus::readv(uint8_t address, ReadBuffer *buffers, size_t cnt)
 
   return ERROR_OK;
 }
-ErrorCode ArduinoI2CBus::writev(uint8_t address, WriteBuffer *buffers, size_t cnt, bool stop) {
+ErrorCode ArduinoI2CBus::writev_impl(uint8_t address, WriteBuffer *buffers, size_t cnt, bool stop) {
 #if defined(USE_ESP8266)
   this->set_pins_and_clock_();  // reconfigure Wire global state in case there are multiple instances
 #endif
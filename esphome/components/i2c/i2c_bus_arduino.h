@@ -19,8 +19,6 @@ class ArduinoI2CBus : public I2CBus, public Component {
  public:
   void setup() override;
   void dump_config() override;
-  ErrorCode readv(uint8_t address, ReadBuffer *buffers, size_t cnt) override;
-  ErrorCode writev(uint8_t address, WriteBuffer *buffers, size_t cnt, bool stop) override;
   float get_setup_priority() const override { return setup_priority::BUS; }
 
   void set_scan(bool scan) { scan_ = scan; }
@@ -35,6 +33,9 @@ class ArduinoI2CBus : public I2CBus, public Component {
   RecoveryCode recovery_result_;
 
  protected:
+  ErrorCode readv_impl(uint8_t address, ReadBuffer *buffers, size_t cnt) override;
+  ErrorCode writev_impl(uint8_t address, WriteBuffer *buffers, size_t cnt, bool stop) override;
+
   TwoWire *wire_;
   uint8_t sda_pin_;
   uint8_t scl_pin_;
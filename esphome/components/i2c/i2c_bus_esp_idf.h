@@ -19,8 +19,6 @@ class IDFI2CBus : public I2CBus, public Component {
  public:
   void setup() override;
   void dump_config() override;
-  ErrorCode readv(uint8_t address, ReadBuffer *buffers, size_t cnt) override;
-  ErrorCode writev(uint8_t address, WriteBuffer *buffers, size_t cnt, bool stop) override;
   float get_setup_priority() const override { return setup_priority::BUS; }
 
   void set_scan(bool scan) { scan_ = scan; }
@@ -36,6 +34,9 @@ class IDFI2CBus : public I2CBus, public Component {
   RecoveryCode recovery_result_;
 
  protected:
+  ErrorCode readv_impl(uint8_t address, ReadBuffer *buffers, size_t cnt) override;
+  ErrorCode writev_impl(uint8_t address, WriteBuffer *buffers, size_t cnt, bool stop) override;
+
   i2c_port_t port_;
   uint8_t sda_pin_;
   bool sda_pullup_enabled_;
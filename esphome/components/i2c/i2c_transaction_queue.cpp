@@ -0,0 +1,153 @@
+#include "i2c_transaction_queue.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+#include <cinttypes>
+
+namespace esphome {
+namespace i2c {
+
+static const char *const TAG = "i2c.queue";
+
+static const uint32_t STATS_INTERVAL = 60000;
+
+#ifdef USE_ESP32
+static const uint32_t WORKER_STACK_SIZE = 3072;
+static const UBaseType_t WORKER_PRIORITY = 1;
+#endif
+
+void I2CTransactionQueue::setup() {
+  this->bus_->set_transaction_queue(this);
+#ifdef USE_ESP32
+  if (xTaskCreate(I2CTransactionQueue::worker_task, "i2c_queue", WORKER_STACK_SIZE, this, WORKER_PRIORITY,
+                  &this->worker_handle_) != pdPASS) {
+    // Still usable, loop() executes the transactions instead.
+    ESP_LOGW(TAG, "Could not start the worker task");
+    this->worker_handle_ = nullptr;
+  }
+#endif
+  this->set_interval("stats", STATS_INTERVAL, [this]() { this->log_stats_(); });
+}
+
+void I2CTransactionQueue::dump_config() {
+  ESP_LOGCONFIG(TAG, "I2C Transaction Queue:");
+#ifdef USE_ESP32
+  ESP_LOGCONFIG(TAG, "  Worker task: %s", YESNO(this->worker_handle_ != nullptr));
+#endif
+}
+
+#ifdef USE_ESP32
+void I2CTransactionQueue::worker_task(void *arg) {
+  auto *queue = reinterpret_cast<I2CTransactionQueue *>(arg);
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    while (queue->run_next_()) {
+    }
+  }
+}
+#endif
+
+void I2CTransactionQueue::submit(uint8_t address, std::vector<I2CTransfer> &&transfers, I2CCallback &&callback) {
+  auto job = make_unique<Job>();
+  job->address = address;
+  job->transfers = std::move(transfers);
+  job->callback = std::move(callback);
+  job->submitted = micros();
+  {
+    LockGuard guard(this->lock_);
+    this->pending_.push_back(std::move(job));
+  }
+#ifdef USE_ESP32
+  if (this->worker_handle_ != nullptr)
+    xTaskNotifyGive(this->worker_handle_);
+#endif
+}
+
+ErrorCode I2CTransactionQueue::execute(I2CBus *bus, uint8_t address, std::vector<I2CTransfer> &transfers,
+                                       std::vector<uint8_t> &result) {
+  for (auto &transfer : transfers) {
+    if (!transfer.write.empty()) {
+      ErrorCode err = bus->write(address, transfer.write.data(), transfer.write.size(), transfer.stop);
+      if (err != ERROR_OK)
+        return err;
+    }
+    if (transfer.read_len != 0) {
+      const size_t offset = result.size();
+      result.resize(offset + transfer.read_len);
+      ErrorCode err = bus->read(address, result.data() + offset, transfer.read_len);
+      if (err != ERROR_OK)
+        return err;
+    }
+  }
+  return ERROR_OK;
+}
+
+bool I2CTransactionQueue::run_next_() {
+  std::unique_ptr<Job> job;
+  {
+    LockGuard guard(this->lock_);
+    if (this->pending_.empty())
+      return false;
+    job = std::move(this->pending_.front());
+    this->pending_.pop_front();
+  }
+
+  job->started = micros();
+  {
+    I2CBusLock bus_lock(this->bus_);
+    job->error = execute(this->bus_, job->address, job->transfers, job->result);
+  }
+  job->completed = micros();
+
+  LockGuard guard(this->lock_);
+  this->completed_.push_back(std::move(job));
+  return true;
+}
+
+void I2CTransactionQueue::loop() {
+#ifdef USE_ESP32
+  if (this->worker_handle_ == nullptr) {
+    while (this->run_next_()) {
+    }
+  }
+#else
+  while (this->run_next_()) {
+  }
+#endif
+
+  {
+    LockGuard guard(this->lock_);
+    if (this->completed_.empty())
+      return;
+    this->delivering_.swap(this->completed_);
+  }
+  for (auto &job : this->delivering_) {
+    const uint32_t latency = job->completed - job->submitted;
+    this->batches_++;
+    this->busy_time_ += job->completed - job->started;
+    this->total_latency_ += latency;
+    this->max_latency_ = std::max(this->max_latency_, latency);
+    this->interval_max_latency_ = std::max(this->interval_max_latency_, latency);
+    if (job->error != ERROR_OK) {
+      ESP_LOGV(TAG, "Batch for 0x%02X failed: %d", job->address, job->error);
+    }
+    job->callback(job->error, job->result);
+  }
+  this->delivering_.clear();
+}
+
+void I2CTransactionQueue::log_stats_() {
+  const uint32_t batches = this->batches_ - this->last_stats_batches_;
+  if (batches == 0)
+    return;
+  ESP_LOGD(TAG, "%" PRIu32 " batches, bus utilisation %.1f%%, latency average %" PRIu32 "us, max %" PRIu32 "us",
+           batches, (this->busy_time_ - this->last_stats_busy_time_) / (STATS_INTERVAL * 10.0f),
+           uint32_t((this->total_latency_ - this->last_stats_total_latency_) / batches), this->interval_max_latency_);
+  this->last_stats_batches_ = this->batches_;
+  this->last_stats_busy_time_ = this->busy_time_;
+  this->last_stats_total_latency_ = this->total_latency_;
+  this->interval_max_latency_ = 0;
+}
+
+}  // namespace i2c
+}  // namespace esphome
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "i2c_bus.h"
+#include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#ifdef USE_ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+namespace esphome {
+namespace i2c {
+
+/// @brief One transfer of a batch: write the bytes of @p write (if any), then read @p read_len bytes (if any).
+struct I2CTransfer {
+  std::vector<uint8_t> write;
+  size_t read_len{0};
+  /// Send a stop after the write (true) or a repeated start before the read (false).
+  bool stop{true};
+};
+
+/// @brief Receives the result of the first failing transfer (or ERROR_OK) and the bytes of all reads concatenated.
+using I2CCallback = std::function<void(ErrorCode, const std::vector<uint8_t> &)>;
+
+/// @brief Executes batches of transfers for the devices on one bus away from the components' update()/loop().
+/// @details On the ESP32 the batches are executed by a worker task, so a slow device (clock stretching, long
+/// conversions) no longer stalls the main loop; on other platforms they are executed from loop(). The transfers of
+/// a batch are executed back to back while holding the bus lock, transfers of other devices never interleave.
+/// Callbacks are always called from the main loop, in submission order.
+class I2CTransactionQueue : public Component {
+ public:
+  void set_bus(I2CBus *bus) { this->bus_ = bus; }
+
+  void setup() override;
+  void loop() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::BUS - 1.0f; }
+
+  /// @brief Queue @p transfers for the device at @p address. Must be called from the main loop.
+  void submit(uint8_t address, std::vector<I2CTransfer> &&transfers, I2CCallback &&callback);
+
+  /// @brief Execute @p transfers directly on @p bus, appending the read bytes to @p result.
+  static ErrorCode execute(I2CBus *bus, uint8_t address, std::vector<I2CTransfer> &transfers,
+                           std::vector<uint8_t> &result);
+
+  /// Number of completed batches since boot.
+  uint32_t get_batches() const { return this->batches_; }
+  /// Time the bus was busy executing batches since boot, in µs.
+  uint64_t get_busy_time() const { return this->busy_time_; }
+  /// Largest time from submission to completion of a batch since boot, in µs.
+  uint32_t get_max_latency() const { return this->max_latency_; }
+  /// Average time from submission to completion of a batch since boot, in µs.
+  uint32_t get_average_latency() const {
+    return this->batches_ == 0 ? 0 : uint32_t(this->total_latency_ / this->batches_);
+  }
+
+ protected:
+  struct Job {
+    uint8_t address;
+    std::vector<I2CTransfer> transfers;
+    I2CCallback callback;
+    std::vector<uint8_t> result;
+    ErrorCode error{ERROR_OK};
+    uint32_t submitted;
+    uint32_t started;
+    uint32_t completed;
+  };
+
+  /// Execute the oldest pending job, returns false if there was none.
+  bool run_next_();
+  void log_stats_();
+
+#ifdef USE_ESP32
+  static void worker_task(void *arg);
+  TaskHandle_t worker_handle_{nullptr};
+#endif
+
+  I2CBus *bus_;
+  /// Guards pending_ and completed_, which are shared with the worker task.
+  Mutex lock_;
+  std::deque<std::unique_ptr<Job>> pending_;
+  std::vector<std::unique_ptr<Job>> completed_;
+  /// Completed jobs taken over by loop(), kept to reuse its capacity.
+  std::vector<std::unique_ptr<Job>> delivering_;
+
+  uint32_t batches_{0};
+  uint64_t busy_time_{0};
+  uint64_t total_latency_{0};
+  uint32_t max_latency_{0};
+  uint32_t last_stats_batches_{0};
+  uint64_t last_stats_busy_time_{0};
+  uint64_t last_stats_total_latency_{0};
+  /// Largest latency since the last statistics log.
+  uint32_t interval_max_latency_{0};
+};
+
+}  // namespace i2c
+}  // namespace esphome
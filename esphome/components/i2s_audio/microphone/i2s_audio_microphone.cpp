@@ -10,8 +10,6 @@
 namespace esphome {
 namespace i2s_audio {
 
-static const size_t BUFFER_SIZE = 512;
-
 static const char *const TAG = "i2s_audio.microphone";
 
 void I2SAudioMicrophone::setup() {
@@ -154,16 +152,24 @@ void I2SAudioMicrophone::stop_() {
   this->status_clear_error();
 }
 
-size_t I2SAudioMicrophone::read(int16_t *buf, size_t len) {
+size_t I2SAudioMicrophone::read(int16_t *buf, size_t len) { return this->read_(buf, len, 100 / portTICK_PERIOD_MS); }
+
+size_t I2SAudioMicrophone::read_available_(int16_t *buf, size_t max_samples) {
+  return this->read_(buf, max_samples * sizeof(int16_t), 0) / sizeof(int16_t);
+}
+
+size_t I2SAudioMicrophone::read_(int16_t *buf, size_t len, TickType_t ticks_to_wait) {
   size_t bytes_read = 0;
-  esp_err_t err = i2s_read(this->parent_->get_port(), buf, len, &bytes_read, (100 / portTICK_PERIOD_MS));
+  esp_err_t err = i2s_read(this->parent_->get_port(), buf, len, &bytes_read, ticks_to_wait);
   if (err != ESP_OK) {
     ESP_LOGW(TAG, "Error reading from I2S microphone: %s", esp_err_to_name(err));
     this->status_set_warning();
     return 0;
   }
   if (bytes_read == 0) {
-    this->status_set_warning();
+    // nothing buffered yet is expected when not waiting
+    if (ticks_to_wait != 0)
+      this->status_set_warning();
     return 0;
   }
   this->status_clear_warning();
@@ -188,14 +194,6 @@ size_t I2SAudioMicrophone::read(int16_t *buf, size_t len) {
   }
 }
 
-void I2SAudioMicrophone::read_() {
-  std::vector<int16_t> samples;
-  samples.resize(BUFFER_SIZE);
-  size_t bytes_read = this->read(samples.data(), BUFFER_SIZE / sizeof(int16_t));
-  samples.resize(bytes_read / sizeof(int16_t));
-  this->data_callbacks_.call(samples);
-}
-
 void I2SAudioMicrophone::loop() {
   switch (this->state_) {
     case microphone::STATE_STOPPED:
@@ -204,8 +202,8 @@ void I2SAudioMicrophone::loop() {
       this->start_();
       break;
     case microphone::STATE_RUNNING:
-      if (this->data_callbacks_.size() > 0) {
-        this->read_();
+      if (this->has_consumers_()) {
+        this->capture_();
       }
       break;
     case microphone::STATE_STOPPING:
@@ -33,7 +33,9 @@ class I2SAudioMicrophone : public I2SAudioIn, public microphone::Microphone, pub
  protected:
   void start_();
   void stop_();
-  void read_();
+  size_t read_available_(int16_t *buf, size_t max_samples) override;
+  /// Read up to \p len bytes, waiting up to \p ticks_to_wait for the DMA buffers, and convert them to 16 bit.
+  size_t read_(int16_t *buf, size_t len, TickType_t ticks_to_wait);
 
   int8_t din_pin_{I2S_PIN_NO_CHANGE};
 #if SOC_I2S_SUPPORTS_ADC
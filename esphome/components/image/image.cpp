@@ -5,76 +5,78 @@
 namespace esphome {
 namespace image {
 
+/**
+ * Draw the visible rows of an image. The area is clipped once up front and every row is walked left to right
+ * through a pointer to its data, so the decoder does not recompute a pixel offset for every pixel.
+ * @param get_pixel Decodes the pixel at column x of a row; returns false if it is not drawn.
+ */
+template<typename Decoder>
+static void draw_rows(int x, int y, int width, int height, const uint8_t *data, size_t stride,
+                      display::Display *display, Decoder get_pixel) {
+  int min_x, max_x, min_y, max_y;
+  if (!display->clip(x, y, width, height, min_x, max_x, min_y, max_y))
+    return;
+  Color color;
+  for (int row = min_y; row != max_y; row++) {
+    const uint8_t *row_data = data + (row - y) * stride;
+    for (int col = min_x; col != max_x; col++) {
+      if (get_pixel(row_data, col - x, color))
+        display->draw_pixel_at(col, row, color);
+    }
+  }
+}
+
 void Image::draw(int x, int y, display::Display *display, Color color_on, Color color_off) {
+  const size_t stride = this->get_width_stride();
+  // Every format but binary is drawn where the decoded pixel is opaque
+  auto draw_opaque = [display, x, y, stride, this](auto decode) {
+    draw_rows(x, y, this->width_, this->height_, this->data_start_, stride, display,
+              [decode](const uint8_t *row, int img_x, Color &color) {
+                color = decode(row, img_x);
+                return color.w >= 0x80;
+              });
+  };
   switch (type_) {
-    case IMAGE_TYPE_BINARY: {
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          if (this->get_binary_pixel_(img_x, img_y)) {
-            display->draw_pixel_at(x + img_x, y + img_y, color_on);
-          } else if (!this->transparent_) {
-            display->draw_pixel_at(x + img_x, y + img_y, color_off);
-          }
-        }
-      }
+    case IMAGE_TYPE_BINARY:
+      draw_rows(x, y, this->width_, this->height_, this->data_start_, stride, display,
+                [this, color_on, color_off](const uint8_t *row, int img_x, Color &color) {
+                  if (this->get_binary_pixel_(row, img_x)) {
+                    color = color_on;
+                    return true;
+                  }
+                  color = color_off;
+                  return !this->transparent_;
+                });
       break;
-    }
     case IMAGE_TYPE_GRAYSCALE:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_grayscale_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
-          }
-        }
-      }
+      draw_opaque([this](const uint8_t *row, int img_x) { return this->get_grayscale_pixel_(row, img_x); });
       break;
     case IMAGE_TYPE_RGB565:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_rgb565_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
-          }
-        }
-      }
+      draw_opaque([this](const uint8_t *row, int img_x) { return this->get_rgb565_pixel_(row, img_x); });
       break;
     case IMAGE_TYPE_RGB24:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_rgb24_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
-          }
-        }
-      }
+      draw_opaque([this](const uint8_t *row, int img_x) { return this->get_rgb24_pixel_(row, img_x); });
       break;
     case IMAGE_TYPE_RGBA:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_rgba_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
-          }
-        }
-      }
+      draw_opaque([this](const uint8_t *row, int img_x) { return this->get_rgba_pixel_(row, img_x); });
       break;
   }
 }
 Color Image::get_pixel(int x, int y, Color color_on, Color color_off) const {
   if (x < 0 || x >= this->width_ || y < 0 || y >= this->height_)
     return color_off;
+  const uint8_t *row = this->data_start_ + y * this->get_width_stride();
   switch (this->type_) {
     case IMAGE_TYPE_BINARY:
-      return this->get_binary_pixel_(x, y) ? color_on : color_off;
+      return this->get_binary_pixel_(row, x) ? color_on : color_off;
     case IMAGE_TYPE_GRAYSCALE:
-      return this->get_grayscale_pixel_(x, y);
+      return this->get_grayscale_pixel_(row, x);
     case IMAGE_TYPE_RGB565:
-      return this->get_rgb565_pixel_(x, y);
+      return this->get_rgb565_pixel_(row, x);
     case IMAGE_TYPE_RGB24:
-      return this->get_rgb24_pixel_(x, y);
+      return this->get_rgb24_pixel_(row, x);
     case IMAGE_TYPE_RGBA:
-      return this->get_rgba_pixel_(x, y);
+      return this->get_rgba_pixel_(row, x);
     default:
       return color_off;
   }
@@ -123,20 +125,17 @@ lv_img_dsc_t *Image::get_lv_img_dsc() {
 }
 #endif  // USE_LVGL
 
-bool Image::get_binary_pixel_(int x, int y) const {
-  const uint32_t width_8 = ((this->width_ + 7u) / 8u) * 8u;
-  const uint32_t pos = x + y * width_8;
-  return progmem_read_byte(this->data_start_ + (pos / 8u)) & (0x80 >> (pos % 8u));
+bool Image::get_binary_pixel_(const uint8_t *row, int x) const {
+  return progmem_read_byte(row + x / 8u) & (0x80 >> (x % 8u));
 }
-Color Image::get_rgba_pixel_(int x, int y) const {
-  const uint32_t pos = (x + y * this->width_) * 4;
-  return Color(progmem_read_byte(this->data_start_ + pos + 0), progmem_read_byte(this->data_start_ + pos + 1),
-               progmem_read_byte(this->data_start_ + pos + 2), progmem_read_byte(this->data_start_ + pos + 3));
+Color Image::get_rgba_pixel_(const uint8_t *row, int x) const {
+  const uint8_t *pos = row + x * 4;
+  return Color(progmem_read_byte(pos + 0), progmem_read_byte(pos + 1), progmem_read_byte(pos + 2),
+               progmem_read_byte(pos + 3));
 }
-Color Image::get_rgb24_pixel_(int x, int y) const {
-  const uint32_t pos = (x + y * this->width_) * 3;
-  Color color = Color(progmem_read_byte(this->data_start_ + pos + 0), progmem_read_byte(this->data_start_ + pos + 1),
-                      progmem_read_byte(this->data_start_ + pos + 2));
+Color Image::get_rgb24_pixel_(const uint8_t *row, int x) const {
+  const uint8_t *pos = row + x * 3;
+  Color color = Color(progmem_read_byte(pos + 0), progmem_read_byte(pos + 1), progmem_read_byte(pos + 2));
   if (color.b == 1 && color.r == 0 && color.g == 0 && transparent_) {
     // (0, 0, 1) has been defined as transparent color for non-alpha images.
     // putting blue == 1 as a first condition for performance reasons (least likely value to short-cut the if)
@@ -146,12 +145,12 @@ Color Image::get_rgb24_pixel_(int x, int y) const {
   }
   return color;
 }
-Color Image::get_rgb565_pixel_(int x, int y) const {
-  const uint8_t *pos = this->data_start_;
+Color Image::get_rgb565_pixel_(const uint8_t *row, int x) const {
+  const uint8_t *pos = row;
   if (this->transparent_) {
-    pos += (x + y * this->width_) * 3;
+    pos += x * 3;
   } else {
-    pos += (x + y * this->width_) * 2;
+    pos += x * 2;
   }
   uint16_t rgb565 = encode_uint16(progmem_read_byte(pos), progmem_read_byte(pos + 1));
   auto r = (rgb565 & 0xF800) >> 11;
@@ -162,9 +161,8 @@ Color Image::get_rgb565_pixel_(int x, int y) const {
   return color;
 }
 
-Color Image::get_grayscale_pixel_(int x, int y) const {
-  const uint32_t pos = (x + y * this->width_);
-  const uint8_t gray = progmem_read_byte(this->data_start_ + pos);
+Color Image::get_grayscale_pixel_(const uint8_t *row, int x) const {
+  const uint8_t gray = progmem_read_byte(row + x);
   uint8_t alpha = (gray == 1 && transparent_) ? 0 : 0xFF;
   return Color(gray, gray, gray, alpha);
 }
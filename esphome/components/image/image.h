@@ -54,11 +54,12 @@ class Image : public display::BaseImage {
   lv_img_dsc_t *get_lv_img_dsc();
 #endif
  protected:
-  bool get_binary_pixel_(int x, int y) const;
-  Color get_rgb24_pixel_(int x, int y) const;
-  Color get_rgba_pixel_(int x, int y) const;
-  Color get_rgb565_pixel_(int x, int y) const;
-  Color get_grayscale_pixel_(int x, int y) const;
+  /// Decode the pixel at column x of the row starting at row, used by both get_pixel() and draw().
+  bool get_binary_pixel_(const uint8_t *row, int x) const;
+  Color get_rgb24_pixel_(const uint8_t *row, int x) const;
+  Color get_rgba_pixel_(const uint8_t *row, int x) const;
+  Color get_rgb565_pixel_(const uint8_t *row, int x) const;
+  Color get_grayscale_pixel_(const uint8_t *row, int x) const;
 
   int width_;
   int height_;
@@ -5,11 +5,15 @@
 #include "lvgl_hal.h"
 #include "lvgl_esphome.h"
 
+#include <algorithm>
 #include <numeric>
 
 namespace esphome {
 namespace lvgl {
 static const char *const TAG = "lvgl";
+// Side of the square tiles used when transposing a buffer, small enough that a source and destination tile stay in
+// cache at the same time.
+static const lv_coord_t ROTATE_TILE_SIZE = 16;
 
 static const char *const EVENT_NAMES[] = {
     "NONE",
@@ -143,6 +147,33 @@ void LvglComponent::show_prev_page(lv_scr_load_anim_t anim, uint32_t time) {
   } while (this->pages_[this->current_page_]->skip);  // skip empty pages()
   this->show_page(this->current_page_, anim, time);
 }
+/**
+ * Rotate a width x height buffer by 90 (clockwise) or 270 degrees into a height x width buffer.
+ * The buffer is walked tile by tile rather than one source row at a time, since the column-major writes of a
+ * straight scatter would otherwise touch a different cache line for every pixel.
+ */
+static void rotate_buffer(const lv_color_t *src, lv_color_t *dst, lv_coord_t width, lv_coord_t height,
+                          bool clockwise) {
+  for (lv_coord_t row = 0; row < height; row += ROTATE_TILE_SIZE) {
+    const lv_coord_t row_end = std::min<lv_coord_t>(row + ROTATE_TILE_SIZE, height);
+    for (lv_coord_t col = 0; col < width; col += ROTATE_TILE_SIZE) {
+      const lv_coord_t col_end = std::min<lv_coord_t>(col + ROTATE_TILE_SIZE, width);
+      for (lv_coord_t c = col; c != col_end; c++) {
+        const lv_color_t *in = src + row * width + c;
+        if (clockwise) {
+          lv_color_t *out = dst + c * height + (height - 1 - row);
+          for (lv_coord_t r = row; r != row_end; r++, in += width)
+            *out-- = *in;
+        } else {
+          lv_color_t *out = dst + (width - 1 - c) * height + row;
+          for (lv_coord_t r = row; r != row_end; r++, in += width)
+            *out++ = *in;
+        }
+      }
+    }
+  }
+}
+
 void LvglComponent::draw_buffer_(const lv_area_t *area, lv_color_t *ptr) {
   auto width = lv_area_get_width(area);
   auto height = lv_area_get_height(area);
@@ -151,11 +182,7 @@ void LvglComponent::draw_buffer_(const lv_area_t *area, lv_color_t *ptr) {
   lv_color_t *dst = this->rotate_buf_;
   switch (this->rotation) {
     case display::DISPLAY_ROTATION_90_DEGREES:
-      for (lv_coord_t x = height; x-- != 0;) {
-        for (lv_coord_t y = 0; y != width; y++) {
-          dst[y * height + x] = *ptr++;
-        }
-      }
+      rotate_buffer(ptr, dst, width, height, true);
       y1 = x1;
       x1 = this->disp_drv_.ver_res - area->y1 - height;
       width = height;
@@ -163,21 +190,13 @@ void LvglComponent::draw_buffer_(const lv_area_t *area, lv_color_t *ptr) {
       break;
 
     case display::DISPLAY_ROTATION_180_DEGREES:
-      for (lv_coord_t y = height; y-- != 0;) {
-        for (lv_coord_t x = width; x-- != 0;) {
-          dst[y * width + x] = *ptr++;
-        }
-      }
+      std::reverse_copy(ptr, ptr + width * height, dst);
       x1 = this->disp_drv_.hor_res - x1 - width;
       y1 = this->disp_drv_.ver_res - y1 - height;
       break;
 
     case display::DISPLAY_ROTATION_270_DEGREES:
-      for (lv_coord_t x = 0; x != height; x++) {
-        for (lv_coord_t y = width; y-- != 0;) {
-          dst[y * height + x] = *ptr++;
-        }
-      }
+      rotate_buffer(ptr, dst, width, height, false);
       x1 = y1;
       y1 = this->disp_drv_.hor_res - area->x1 - width;
       width = height;
@@ -24,7 +24,10 @@ static const char *const TAG = "micro_wake_word";
 static const size_t SAMPLE_RATE_HZ = 16000;  // 16 kHz
 static const size_t BUFFER_LENGTH = 64;      // 0.064 seconds
 static const size_t BUFFER_SIZE = SAMPLE_RATE_HZ / 1000 * BUFFER_LENGTH;
-static const size_t INPUT_BUFFER_SIZE = 16 * SAMPLE_RATE_HZ / 1000;  // 16ms * 16kHz / 1000ms
+// Maximum number of feature slices generated before they are passed to the models
+static const size_t MAX_FEATURE_BATCH = 4;
+// Report the processing time after this many samples (10 s) of audio
+static const uint32_t PROCESSING_REPORT_SAMPLES = SAMPLE_RATE_HZ * 10;
 
 float MicroWakeWord::get_setup_priority() const { return setup_priority::AFTER_CONNECTION; }
 
@@ -66,6 +69,8 @@ void MicroWakeWord::setup() {
     return;
   }
 
+  this->reader_ = this->microphone_->add_reader(BUFFER_SIZE);
+
   ESP_LOGCONFIG(TAG, "Micro Wake Word initialized");
 
   this->frontend_config_.window.size_ms = FEATURE_DURATION_MS;
@@ -114,17 +119,41 @@ void MicroWakeWord::loop() {
         this->set_state_(State::DETECTING_WAKE_WORD);
       }
       break;
-    case State::DETECTING_WAKE_WORD:
-      while (!this->has_enough_samples_()) {
-        this->read_microphone_();
+    case State::DETECTING_WAKE_WORD: {
+      // Process every window the microphone captured since the last loop, in batches of feature slices
+      const uint32_t start = micros();
+      int8_t features[MAX_FEATURE_BATCH][PREPROCESSOR_FEATURE_SIZE];
+      while (this->state_ == State::DETECTING_WAKE_WORD && this->has_enough_samples_()) {
+        const size_t slices = this->generate_features_(features, MAX_FEATURE_BATCH);
+        this->processed_samples_ += slices * this->new_samples_to_get_();
+        size_t processed = 0;
+        while (processed < slices) {
+          // Pass the models every slice up to the next one that can change the detection result at once
+          const size_t count = std::min(slices - processed, this->slices_until_detection_());
+          this->update_model_probabilities_(features + processed, count);
+          processed += count;
+          if (this->detect_wake_words_()) {
+            ESP_LOGD(TAG, "Wake Word '%s' Detected", (this->detected_wake_word_).c_str());
+            this->detected_ = true;
+            this->set_state_(State::STOP_MICROPHONE);
+            break;
+          }
+        }
       }
-      this->update_model_probabilities_();
-      if (this->detect_wake_words_()) {
-        ESP_LOGD(TAG, "Wake Word '%s' Detected", (this->detected_wake_word_).c_str());
-        this->detected_ = true;
-        this->set_state_(State::STOP_MICROPHONE);
+      this->processing_us_ += micros() - start;
+      if (this->processed_samples_ >= PROCESSING_REPORT_SAMPLES) {
+        ESP_LOGV(TAG, "Processing takes %.1f us per 10 ms of audio",
+                 this->processing_us_ * (SAMPLE_RATE_HZ / 100.0f) / this->processed_samples_);
+        this->processing_us_ = 0;
+        this->processed_samples_ = 0;
+      }
+      if (this->reader_->get_overruns() != this->reported_overruns_) {
+        ESP_LOGW(TAG, "Audio was not processed in time and some samples were dropped. Wake word detection accuracy "
+                      "will be reduced.");
+        this->reported_overruns_ = this->reader_->get_overruns();
       }
       break;
+    }
     case State::STOP_MICROPHONE:
       ESP_LOGD(TAG, "Stopping Microphone");
       this->microphone_->stop();
@@ -196,37 +225,9 @@ void MicroWakeWord::set_state_(State state) {
   this->state_ = state;
 }
 
-size_t MicroWakeWord::read_microphone_() {
-  size_t bytes_read = this->microphone_->read(this->input_buffer_, INPUT_BUFFER_SIZE * sizeof(int16_t));
-  if (bytes_read == 0) {
-    return 0;
-  }
-
-  size_t bytes_free = this->ring_buffer_->free();
-
-  if (bytes_free < bytes_read) {
-    ESP_LOGW(TAG,
-             "Not enough free bytes in ring buffer to store incoming audio data (free bytes=%d, incoming bytes=%d). "
-             "Resetting the ring buffer. Wake word detection accuracy will be reduced.",
-             bytes_free, bytes_read);
-
-    this->ring_buffer_->reset();
-  }
-
-  return this->ring_buffer_->write((void *) this->input_buffer_, bytes_read);
-}
-
 bool MicroWakeWord::allocate_buffers_() {
   ExternalRAMAllocator<int16_t> audio_samples_allocator(ExternalRAMAllocator<int16_t>::ALLOW_FAILURE);
 
-  if (this->input_buffer_ == nullptr) {
-    this->input_buffer_ = audio_samples_allocator.allocate(INPUT_BUFFER_SIZE * sizeof(int16_t));
-    if (this->input_buffer_ == nullptr) {
-      ESP_LOGE(TAG, "Could not allocate input buffer");
-      return false;
-    }
-  }
-
   if (this->preprocessor_audio_buffer_ == nullptr) {
     this->preprocessor_audio_buffer_ = audio_samples_allocator.allocate(this->new_samples_to_get_());
     if (this->preprocessor_audio_buffer_ == nullptr) {
@@ -235,21 +236,11 @@ bool MicroWakeWord::allocate_buffers_() {
     }
   }
 
-  if (this->ring_buffer_ == nullptr) {
-    this->ring_buffer_ = RingBuffer::create(BUFFER_SIZE * sizeof(int16_t));
-    if (this->ring_buffer_ == nullptr) {
-      ESP_LOGE(TAG, "Could not allocate ring buffer");
-      return false;
-    }
-  }
-
   return true;
 }
 
 void MicroWakeWord::deallocate_buffers_() {
   ExternalRAMAllocator<int16_t> audio_samples_allocator(ExternalRAMAllocator<int16_t>::ALLOW_FAILURE);
-  audio_samples_allocator.deallocate(this->input_buffer_, INPUT_BUFFER_SIZE * sizeof(int16_t));
-  this->input_buffer_ = nullptr;
   audio_samples_allocator.deallocate(this->preprocessor_audio_buffer_, this->new_samples_to_get_());
   this->preprocessor_audio_buffer_ = nullptr;
 }
@@ -290,23 +281,35 @@ void MicroWakeWord::unload_models_() {
 #endif
 }
 
-void MicroWakeWord::update_model_probabilities_() {
-  int8_t audio_features[PREPROCESSOR_FEATURE_SIZE];
+void MicroWakeWord::update_model_probabilities_(const int8_t audio_features[][PREPROCESSOR_FEATURE_SIZE],
+                                                size_t slices) {
+  // Increase the counter since the last positive detection
+  this->ignore_windows_ = std::min<int32_t>(this->ignore_windows_ + static_cast<int32_t>(slices), 0);
 
-  if (!this->generate_features_for_window_(audio_features)) {
-    return;
+  for (auto &model : this->wake_word_models_) {
+    // Perform inference
+    model.perform_streaming_inference(audio_features, slices);
   }
+#ifdef USE_MICRO_WAKE_WORD_VAD
+  this->vad_model_->perform_streaming_inference(audio_features, slices);
+#endif
+}
 
-  // Increase the counter since the last positive detection
-  this->ignore_windows_ = std::min(this->ignore_windows_ + 1, 0);
+size_t MicroWakeWord::slices_until_detection_() {
+  // Nothing is detected before enough slices have been processed
+  if (this->ignore_windows_ < 0) {
+    return -this->ignore_windows_;
+  }
 
+  // Afterwards the result only changes when a model is invoked
+  size_t slices = SIZE_MAX;
   for (auto &model : this->wake_word_models_) {
-    // Perform inference
-    model.perform_streaming_inference(audio_features);
+    slices = std::min(slices, model.slices_until_invoke());
   }
 #ifdef USE_MICRO_WAKE_WORD_VAD
-  this->vad_model_->perform_streaming_inference(audio_features);
+  slices = std::min(slices, this->vad_model_->slices_until_invoke());
 #endif
+  return slices;
 }
 
 bool MicroWakeWord::detect_wake_words_() {
@@ -338,32 +341,42 @@ bool MicroWakeWord::detect_wake_words_() {
 }
 
 bool MicroWakeWord::has_enough_samples_() {
-  return this->ring_buffer_->available() >=
-         (this->features_step_size_ * (AUDIO_SAMPLE_FREQUENCY / 1000)) * sizeof(int16_t);
+  return this->reader_->available() >= this->new_samples_to_get_();
 }
 
-bool MicroWakeWord::generate_features_for_window_(int8_t features[PREPROCESSOR_FEATURE_SIZE]) {
-  // Ensure we have enough new audio samples in the ring buffer for a full window
-  if (!this->has_enough_samples_()) {
-    return false;
-  }
-
-  size_t bytes_read = this->ring_buffer_->read((void *) (this->preprocessor_audio_buffer_),
-                                               this->new_samples_to_get_() * sizeof(int16_t), pdMS_TO_TICKS(200));
-
-  if (bytes_read == 0) {
-    ESP_LOGE(TAG, "Could not read data from Ring Buffer");
-  } else if (bytes_read < this->new_samples_to_get_() * sizeof(int16_t)) {
-    ESP_LOGD(TAG, "Partial Read of Data by Model");
-    ESP_LOGD(TAG, "Could only read %d bytes when required %d bytes ", bytes_read,
-             (int) (this->new_samples_to_get_() * sizeof(int16_t)));
-    return false;
+size_t MicroWakeWord::generate_features_(int8_t features[][PREPROCESSOR_FEATURE_SIZE], size_t max_slices) {
+  const size_t step = this->new_samples_to_get_();
+  const size_t strides = std::min(max_slices, this->reader_->available() / step);
+  size_t generated = 0;
+  size_t processed = 0;
+  while (processed < strides) {
+    // Run the frontend over as many strides as are contiguous in the capture buffer
+    const int16_t *samples;
+    size_t count = this->reader_->acquire(&samples, (strides - processed) * step) / step;
+    if (count == 0) {
+      // The next stride wraps around the end of the capture buffer
+      this->reader_->read(this->preprocessor_audio_buffer_, step);
+      samples = this->preprocessor_audio_buffer_;
+      count = 1;
+    }
+    for (size_t stride = 0; stride < count; stride++) {
+      size_t num_samples_read;
+      struct FrontendOutput frontend_output =
+          FrontendProcessSamples(&this->frontend_state_, samples + stride * step, step, &num_samples_read);
+      // The frontend has no output until it has seen a full window
+      if (frontend_output.size != 0)
+        this->quantize_features_(frontend_output, features[generated++]);
+    }
+    if (samples != this->preprocessor_audio_buffer_) {
+      this->reader_->release(count * step);
+    }
+    processed += count;
   }
+  return generated;
+}
 
-  size_t num_samples_read;
-  struct FrontendOutput frontend_output = FrontendProcessSamples(
-      &this->frontend_state_, this->preprocessor_audio_buffer_, this->new_samples_to_get_(), &num_samples_read);
-
+void MicroWakeWord::quantize_features_(const struct FrontendOutput &frontend_output,
+                                       int8_t features[PREPROCESSOR_FEATURE_SIZE]) {
   for (size_t i = 0; i < frontend_output.size; ++i) {
     // These scaling values are set to match the TFLite audio frontend int8 output.
     // The feature pipeline outputs 16-bit signed integers in roughly a 0 to 670
@@ -391,13 +404,11 @@ bool MicroWakeWord::generate_features_for_window_(int8_t features[PREPROCESSOR_F
     }
     features[i] = value;
   }
-
-  return true;
 }
 
 void MicroWakeWord::reset_states_() {
   ESP_LOGD(TAG, "Resetting buffers and probabilities");
-  this->ring_buffer_->reset();
+  this->reader_->clear();
   this->ignore_windows_ = -MIN_SLICES_BEFORE_DETECTION;
   for (auto &model : this->wake_word_models_) {
     model.reset_probabilities();
@@ -7,7 +7,6 @@
 
 #include "esphome/core/automation.h"
 #include "esphome/core/component.h"
-#include "esphome/core/ring_buffer.h"
 
 #include "esphome/components/microphone/microphone.h"
 
@@ -64,7 +63,8 @@ class MicroWakeWord : public Component {
   State state_{State::IDLE};
   HighFrequencyLoopRequester high_freq_;
 
-  std::unique_ptr<RingBuffer> ring_buffer_;
+  microphone::CaptureReader *reader_{nullptr};
+  uint32_t reported_overruns_{0};
 
   std::vector<WakeWordModel> wake_word_models_;
 
@@ -84,34 +84,27 @@ class MicroWakeWord : public Component {
 
   uint8_t features_step_size_;
 
-  // Stores audio read from the microphone before being added to the ring buffer.
-  int16_t *input_buffer_{nullptr};
-  // Stores audio to be fed into the audio frontend for generating features.
+  // Stores audio to be fed into the audio frontend when a window wraps around the end of the capture buffer.
   int16_t *preprocessor_audio_buffer_{nullptr};
 
   bool detected_{false};
   std::string detected_wake_word_{""};
 
+  // Time spent generating features and running inference, reported per 10 ms of audio
+  uint32_t processing_us_{0};
+  uint32_t processed_samples_{0};
+
   void set_state_(State state);
 
-  /// @brief Tests if there are enough samples in the ring buffer to generate new features.
+  /// @brief Tests if the microphone captured enough samples to generate new features.
   /// @return True if enough samples, false otherwise.
   bool has_enough_samples_();
 
-  /** Reads audio from microphone into the ring buffer
-   *
-   * Audio data (16000 kHz with int16 samples) is read into the input_buffer_.
-   * Verifies the ring buffer has enough space for all audio data. If not, it logs
-   * a warning and resets the ring buffer entirely.
-   * @return Number of bytes written to the ring buffer
-   */
-  size_t read_microphone_();
-
-  /// @brief Allocates memory for input_buffer_, preprocessor_audio_buffer_, and ring_buffer_
+  /// @brief Allocates memory for preprocessor_audio_buffer_
   /// @return True if successful, false otherwise
   bool allocate_buffers_();
 
-  /// @brief Frees memory allocated for input_buffer_ and preprocessor_audio_buffer_
+  /// @brief Frees memory allocated for preprocessor_audio_buffer_
   void deallocate_buffers_();
 
   /// @brief Loads streaming models and prepares the feature generation frontend
@@ -124,10 +117,14 @@ class MicroWakeWord : public Component {
 
   /** Performs inference with each configured model
    *
-   * If enough audio samples are available, it will generate one slice of new features.
-   * It then loops through and performs inference with each of the loaded models.
+   * All models share the same slices of features, each model copies them into its input tensor at once.
+   * @param features int8_t arrays with the audio features of each slice
+   * @param slices Number of slices in features
    */
-  void update_model_probabilities_();
+  void update_model_probabilities_(const int8_t features[][PREPROCESSOR_FEATURE_SIZE], size_t slices);
+
+  /// @brief Returns the number of slices until detect_wake_words_ can give a different result
+  size_t slices_until_detection_();
 
   /** Checks every model's recent probabilities to determine if the wake word has been predicted
    *
@@ -137,16 +134,22 @@ class MicroWakeWord : public Component {
    */
   bool detect_wake_words_();
 
-  /** Generates features for a window of audio samples
+  /** Generates features for a batch of windows of audio samples
    *
-   * Reads samples from the ring buffer and feeds them into the preprocessor frontend.
+   * Feeds every complete stride of captured audio, up to max_slices, through the preprocessor frontend, which
+   * outputs at most one slice per call.
+   * Strides are read in place from the microphone's capture buffer; only one that wraps around its end is copied.
    * Adapted from TFLite microspeech frontend.
-   * @param features int8_t array to store the audio features
-   * @return True if successful, false otherwise.
+   * @param features int8_t arrays to store the audio features of each slice
+   * @param max_slices Maximum number of slices to generate
+   * @return Number of slices generated
    */
-  bool generate_features_for_window_(int8_t features[PREPROCESSOR_FEATURE_SIZE]);
+  size_t generate_features_(int8_t features[][PREPROCESSOR_FEATURE_SIZE], size_t max_slices);
+
+  /// @brief Scales the frontend's output to the int8 range the models expect
+  void quantize_features_(const struct FrontendOutput &frontend_output, int8_t features[PREPROCESSOR_FEATURE_SIZE]);
 
-  /// @brief Resets the ring buffer, ignore_windows_, and sliding window probabilities
+  /// @brief Resets the capture reader, ignore_windows_, and sliding window probabilities
   void reset_states_();
 
   /// @brief Returns true if successfully registered the streaming model's TensorFlow operations
@@ -71,6 +71,7 @@ bool StreamingModel::load_model(tflite::MicroMutableOpResolver<20> &op_resolver)
       ESP_LOGE(TAG, "Streaming model tensor input is not int8.");
       return false;
     }
+    this->stride_ = input->dims->data[1];
 
     // Verify output tensor matches expected values
     TfLiteTensor *output = this->interpreter_->output(0);
@@ -98,18 +99,23 @@ void StreamingModel::unload_model() {
   this->var_arena_ = nullptr;
 }
 
-bool StreamingModel::perform_streaming_inference(const int8_t features[PREPROCESSOR_FEATURE_SIZE]) {
-  if (this->interpreter_ != nullptr) {
-    TfLiteTensor *input = this->interpreter_->input(0);
-
-    std::memmove(
-        (int8_t *) (tflite::GetTensorData<int8_t>(input)) + PREPROCESSOR_FEATURE_SIZE * this->current_stride_step_,
-        features, PREPROCESSOR_FEATURE_SIZE);
-    ++this->current_stride_step_;
-
-    uint8_t stride = this->interpreter_->input(0)->dims->data[1];
+bool StreamingModel::perform_streaming_inference(const int8_t features[][PREPROCESSOR_FEATURE_SIZE], size_t slices) {
+  if (this->interpreter_ == nullptr) {
+    ESP_LOGE(TAG, "Streaming interpreter is not initialized.");
+    return false;
+  }
 
-    if (this->current_stride_step_ >= stride) {
+  int8_t *input = tflite::GetTensorData<int8_t>(this->interpreter_->input(0));
+  size_t copied = 0;
+  while (copied < slices) {
+    // Copy every slice that fits before the next invocation at once
+    const size_t count = std::min(slices - copied, this->slices_until_invoke());
+    std::memcpy(input + PREPROCESSOR_FEATURE_SIZE * this->current_stride_step_, features[copied],
+                count * PREPROCESSOR_FEATURE_SIZE);
+    this->current_stride_step_ += count;
+    copied += count;
+
+    if (this->current_stride_step_ >= this->stride_) {
       this->current_stride_step_ = 0;
 
       TfLiteStatus invoke_status = this->interpreter_->Invoke();
@@ -125,10 +131,8 @@ bool StreamingModel::perform_streaming_inference(const int8_t features[PREPROCES
         this->last_n_index_ = 0;
       this->recent_streaming_probabilities_[this->last_n_index_] = output->data.uint8[0];  // probability;
     }
-    return true;
   }
-  ESP_LOGE(TAG, "Streaming interpreter is not initialized.");
-  return false;
+  return true;
 }
 
 void StreamingModel::reset_probabilities() {
@@ -18,7 +18,14 @@ class StreamingModel {
   virtual void log_model_config() = 0;
   virtual bool determine_detected() = 0;
 
-  bool perform_streaming_inference(const int8_t features[PREPROCESSOR_FEATURE_SIZE]);
+  /// @brief Copies slices of features into the input tensor, invoking the model each time it is complete
+  /// @param features int8_t arrays with the audio features of each slice
+  /// @param slices Number of slices in features
+  /// @return True if successful, false otherwise
+  bool perform_streaming_inference(const int8_t features[][PREPROCESSOR_FEATURE_SIZE], size_t slices);
+
+  /// @brief Returns the number of slices until the model is invoked next, its probabilities don't change before
+  size_t slices_until_invoke() const { return this->stride_ - this->current_stride_step_; }
 
   /// @brief Sets all recent_streaming_probabilities to 0
   void reset_probabilities();
@@ -33,6 +40,8 @@ class StreamingModel {
 
  protected:
   uint8_t current_stride_step_{0};
+  // Number of slices in the input tensor, the model is invoked once it holds all of them
+  uint8_t stride_{1};
 
   float probability_cutoff_;
   size_t sliding_window_size_;
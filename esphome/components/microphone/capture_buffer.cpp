@@ -0,0 +1,88 @@
+#include "capture_buffer.h"
+
+#include "esphome/core/helpers.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace microphone {
+
+CaptureBuffer::~CaptureBuffer() {
+  RAMAllocator<int16_t> allocator;
+  allocator.deallocate(this->storage_, this->capacity_);
+}
+
+bool CaptureBuffer::allocate(size_t capacity) {
+  RAMAllocator<int16_t> allocator;
+  allocator.deallocate(this->storage_, this->capacity_);
+  this->storage_ = allocator.allocate(capacity);
+  this->capacity_ = this->storage_ == nullptr ? 0 : capacity;
+  this->head_ = 0;
+  this->head_index_ = 0;
+  return this->storage_ != nullptr;
+}
+
+size_t CaptureBuffer::acquire_write(int16_t **data, size_t max_samples) {
+  *data = this->storage_ + this->head_index_;
+  return std::min(max_samples, this->capacity_ - this->head_index_);
+}
+
+void CaptureBuffer::commit_write(size_t samples) {
+  this->head_ += samples;
+  this->head_index_ += samples;
+  if (this->head_index_ >= this->capacity_)
+    this->head_index_ -= this->capacity_;
+}
+
+void CaptureReader::check_overrun_() {
+  const size_t capacity = this->buffer_->capacity_;
+  if (this->buffer_->head_ - this->position_ <= capacity)
+    return;
+  // Resume with the most recent history instead of the oldest sample, which is the next one to be overwritten.
+  const size_t keep = std::min(this->history_, capacity);
+  this->position_ = this->buffer_->head_ - keep;
+  this->index_ = (this->buffer_->head_index_ + capacity - keep) % capacity;
+  this->overruns_++;
+}
+
+size_t CaptureReader::available() {
+  this->check_overrun_();
+  return this->buffer_->head_ - this->position_;
+}
+
+size_t CaptureReader::acquire(const int16_t **data, size_t max_samples) {
+  const size_t available = this->available();
+  *data = this->buffer_->storage_ + this->index_;
+  return std::min({available, this->buffer_->capacity_ - this->index_, max_samples});
+}
+
+void CaptureReader::release(size_t samples) {
+  samples = std::min(samples, this->available());
+  if (samples == 0)
+    return;
+  this->position_ += samples;
+  this->index_ = (this->index_ + samples) % this->buffer_->capacity_;
+}
+
+size_t CaptureReader::read(int16_t *data, size_t max_samples) {
+  size_t total = 0;
+  while (total < max_samples) {
+    const int16_t *span;
+    const size_t len = this->acquire(&span, max_samples - total);
+    if (len == 0)
+      break;
+    memcpy(data + total, span, len * sizeof(int16_t));
+    this->release(len);
+    total += len;
+  }
+  return total;
+}
+
+void CaptureReader::clear() {
+  this->position_ = this->buffer_->head_;
+  this->index_ = this->buffer_->head_index_;
+}
+
+}  // namespace microphone
+}  // namespace esphome
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace microphone {
+
+/** Ring of captured audio samples shared by all consumers of a microphone.
+ *
+ * The microphone is the only writer and never waits for its readers: new samples always overwrite the oldest ones.
+ * Every consumer owns a CaptureReader cursor and reads the samples in place. A reader that falls more than the
+ * capacity behind loses the overwritten samples and gets an overrun counted. Writer and readers have to run in the
+ * same task (the main loop).
+ */
+class CaptureBuffer {
+ public:
+  ~CaptureBuffer();
+
+  /// Allocate room for \p capacity samples, dropping all buffered audio.
+  bool allocate(size_t capacity);
+  size_t get_capacity() const { return this->capacity_; }
+
+  /// Returns a contiguous span of up to \p max_samples to capture into; it overwrites the oldest samples.
+  size_t acquire_write(int16_t **data, size_t max_samples);
+  /// Publish the first \p samples samples of the span returned by acquire_write().
+  void commit_write(size_t samples);
+
+ protected:
+  friend class CaptureReader;
+
+  int16_t *storage_{nullptr};
+  size_t capacity_{0};
+  /// Total number of samples written so far, wraps around.
+  uint32_t head_{0};
+  /// Storage index of the next sample to write.
+  size_t head_index_{0};
+};
+
+/// Read cursor of a single consumer of a CaptureBuffer.
+class CaptureReader {
+ public:
+  CaptureReader(CaptureBuffer *buffer, size_t history) : buffer_(buffer), history_(history) {}
+
+  /// Number of unread samples.
+  size_t available();
+  /// Returns the oldest contiguous span of up to \p max_samples unread samples without copying them.
+  size_t acquire(const int16_t **data, size_t max_samples);
+  /// Mark the next \p samples samples as read.
+  void release(size_t samples);
+  /// Copy up to \p max_samples unread samples into \p data and mark them as read.
+  size_t read(int16_t *data, size_t max_samples);
+  /// Skip all unread samples.
+  void clear();
+
+  /// Number of samples this reader needs the buffer to hold.
+  size_t get_history() const { return this->history_; }
+  /// Number of times unread samples were overwritten.
+  uint32_t get_overruns() const { return this->overruns_; }
+
+ protected:
+  /// Catch up with the writer if it has overwritten unread samples.
+  void check_overrun_();
+
+  CaptureBuffer *buffer_;
+  size_t history_;
+  uint32_t position_{0};
+  size_t index_{0};
+  uint32_t overruns_{0};
+};
+
+}  // namespace microphone
+}  // namespace esphome
@@ -0,0 +1,62 @@
+#include "microphone.h"
+
+#include "esphome/core/log.h"
+
+#include <algorithm>
+
+namespace esphome {
+namespace microphone {
+
+static const char *const TAG = "microphone";
+
+/// Largest block read from the hardware at once, 32ms at 16kHz.
+static const size_t MAX_CAPTURE_SAMPLES = 512;
+
+CaptureReader *Microphone::add_reader(size_t history_samples) {
+  this->readers_.push_back(make_unique<CaptureReader>(&this->capture_buffer_, history_samples));
+  this->readers_.back()->clear();
+  return this->readers_.back().get();
+}
+
+void Microphone::remove_reader(CaptureReader *reader) {
+  this->readers_.erase(std::remove_if(this->readers_.begin(), this->readers_.end(),
+                                      [reader](const std::unique_ptr<CaptureReader> &r) { return r.get() == reader; }),
+                       this->readers_.end());
+}
+
+size_t Microphone::capture_() {
+  // The buffer is (re)allocated lazily, so that it fits the largest capture plus the history of every reader.
+  size_t capacity = MAX_CAPTURE_SAMPLES;
+  for (auto &reader : this->readers_)
+    capacity = std::max(capacity, reader->get_history() + MAX_CAPTURE_SAMPLES);
+  if (this->capture_buffer_.get_capacity() < capacity) {
+    if (!this->capture_buffer_.allocate(capacity)) {
+      ESP_LOGE(TAG, "Could not allocate capture buffer of %zu samples", capacity);
+      return 0;
+    }
+    ESP_LOGD(TAG, "Allocated capture buffer of %zu samples for %zu readers", capacity, this->readers_.size());
+    for (auto &reader : this->readers_)
+      reader->clear();
+  }
+
+  // Take what is there in blocks of at most MAX_CAPTURE_SAMPLES until the hardware has no more. Blocks can be short
+  // where the buffer wraps around, so only an empty read ends the capture.
+  size_t total = 0;
+  while (total < capacity) {
+    int16_t *data;
+    const size_t len = this->capture_buffer_.acquire_write(&data, MAX_CAPTURE_SAMPLES);
+    const size_t samples = this->read_available_(data, len);
+    this->capture_buffer_.commit_write(samples);
+    if (samples > 0 && this->data_callbacks_.size() > 0) {
+      this->callback_samples_.assign(data, data + samples);
+      this->data_callbacks_.call(this->callback_samples_);
+    }
+    total += samples;
+    if (samples == 0)
+      break;
+  }
+  return total;
+}
+
+}  // namespace microphone
+}  // namespace esphome
@@ -3,9 +3,12 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <vector>
 #include "esphome/core/helpers.h"
 
+#include "capture_buffer.h"
+
 namespace esphome {
 namespace microphone {
 
@@ -23,15 +26,46 @@ class Microphone {
   void add_data_callback(std::function<void(const std::vector<int16_t> &)> &&data_callback) {
     this->data_callbacks_.add(std::move(data_callback));
   }
+  /// Read up to \p len bytes of samples directly from the hardware. Consumers should prefer add_reader().
   virtual size_t read(int16_t *buf, size_t len) = 0;
 
+  /** Register a consumer of the shared capture buffer.
+   *
+   * While the microphone runs it captures into one buffer that every reader consumes in place at its own pace,
+   * so several consumers no longer read (and copy) the same audio separately.
+   *
+   * @param history_samples Number of samples the buffer has to keep for this reader
+   * @return The reader, owned by the microphone
+   */
+  CaptureReader *add_reader(size_t history_samples);
+  /// Unregister and delete a reader returned by add_reader().
+  void remove_reader(CaptureReader *reader);
+
   bool is_running() const { return this->state_ == STATE_RUNNING; }
   bool is_stopped() const { return this->state_ == STATE_STOPPED; }
 
  protected:
+  bool has_consumers_() const { return !this->readers_.empty() || this->data_callbacks_.size() > 0; }
+  /** Capture what the hardware has buffered into the shared buffer and pass it to the data callbacks.
+   *
+   * Implementations call this from their loop() while running; it never blocks, so it can be called every loop.
+   * @return Number of samples captured
+   */
+  size_t capture_();
+  /** Read samples the hardware has already buffered into \p buf, without waiting for more.
+   *
+   * The hook capture_() is built on, every microphone has to provide it.
+   * @return Number of samples read, at most \p max_samples
+   */
+  virtual size_t read_available_(int16_t *buf, size_t max_samples) = 0;
+
   State state_{STATE_STOPPED};
 
   CallbackManager<void(const std::vector<int16_t> &)> data_callbacks_{};
+  CaptureBuffer capture_buffer_;
+  std::vector<std::unique_ptr<CaptureReader>> readers_;
+  /// Samples of the last capture for the data callbacks, kept to avoid an allocation per capture.
+  std::vector<int16_t> callback_samples_;
 };
 
 }  // namespace microphone
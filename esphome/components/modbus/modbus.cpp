@@ -2,6 +2,9 @@
 #include "esphome/core/log.h"
 #include "esphome/core/helpers.h"
 
+#include <algorithm>
+#include <cinttypes>
+
 namespace esphome {
 namespace modbus {
 
@@ -11,29 +14,64 @@ void Modbus::setup() {
   if (this->flow_control_pin_ != nullptr) {
     this->flow_control_pin_->setup();
   }
+  // Modbus over serial line spec 2.5.1.1: 3.5 character times, fixed at 1.75ms above 19200 baud
+  const uint32_t char_time = this->get_char_time_us();
+  if (this->parent_->get_baud_rate() > 19200 || char_time == 0) {
+    this->inter_frame_us_ = 1750;
+  } else {
+    this->inter_frame_us_ = char_time * 7 / 2;
+  }
+  this->rx_data_.reserve(MAX_FRAME_SIZE);
+}
+uint32_t Modbus::get_char_time_us() const {
+  const uint32_t baud_rate = this->parent_->get_baud_rate();
+  if (baud_rate == 0)
+    return 0;
+  uint32_t char_bits = 1 + this->parent_->get_data_bits() + this->parent_->get_stop_bits();
+  if (this->parent_->get_parity() != uart::UART_CONFIG_PARITY_NONE)
+    char_bits++;
+  return char_bits * 1000000UL / baud_rate;
 }
 void Modbus::loop() {
   const uint32_t now = millis();
 
-  while (this->available()) {
-    uint8_t byte;
-    this->read_byte(&byte);
-    if (this->parse_modbus_byte_(byte)) {
-      this->last_modbus_byte_ = now;
-    } else {
-      size_t at = this->rx_buffer_.size();
-      if (at > 0) {
-        ESP_LOGV(TAG, "Clearing buffer of %d bytes - parse failed", at);
-        this->rx_buffer_.clear();
+  if (this->available()) {
+    // Bytes are only timestamped when read, and the UART driver hands them over in chunks, so a single idle poll
+    // between two reads proves nothing when the loop runs slowly. Only two idle polls at least one inter-frame gap
+    // apart show that the bus really was silent long enough to end the frame.
+    if (this->rx_pos_ > 0 && this->idle_polls_ >= 2 &&
+        this->last_idle_us_ - this->first_idle_us_ >= this->inter_frame_us_) {
+      ESP_LOGV(TAG, "Incomplete frame of %d bytes - inter-frame gap", this->rx_pos_);
+      this->resync_(true);
+      this->reset_frame_();
+    }
+    this->idle_polls_ = 0;
+    while (this->available()) {
+      uint8_t byte;
+      this->read_byte(&byte);
+      // a full buffer holds no frame that can still complete, drop bytes from its start to make room for this one
+      if (this->rx_pos_ >= MAX_FRAME_SIZE)
+        this->resync_(false);
+      if (this->parse_modbus_byte_(byte)) {
+        this->last_modbus_byte_ = now;
+      } else {
+        this->resync_(false);
       }
     }
+  } else {
+    const uint32_t now_us = micros();
+    if (this->idle_polls_ == 0)
+      this->first_idle_us_ = now_us;
+    this->last_idle_us_ = now_us;
+    if (this->idle_polls_ < 2)
+      this->idle_polls_++;
   }
 
   if (now - this->last_modbus_byte_ > 50) {
-    size_t at = this->rx_buffer_.size();
-    if (at > 0) {
-      ESP_LOGV(TAG, "Clearing buffer of %d bytes - timeout", at);
-      this->rx_buffer_.clear();
+    if (this->rx_pos_ > 0) {
+      ESP_LOGV(TAG, "Incomplete frame of %d bytes - timeout", this->rx_pos_);
+      this->resync_(true);
+      this->reset_frame_();
     }
 
     // stop blocking new send commands after sent_wait_time_ ms after response received
@@ -46,88 +84,130 @@ void Modbus::loop() {
   }
 }
 
-bool Modbus::parse_modbus_byte_(uint8_t byte) {
-  size_t at = this->rx_buffer_.size();
-  this->rx_buffer_.push_back(byte);
-  const uint8_t *raw = &this->rx_buffer_[0];
-  ESP_LOGVV(TAG, "Modbus received Byte  %d (0X%x)", byte, byte);
-  // Byte 0: modbus address (match all)
-  if (at == 0)
-    return true;
-  uint8_t address = raw[0];
-  uint8_t function_code = raw[1];
-  // Byte 2: Size (with modbus rtu function code 4/3)
-  // See also https://en.wikipedia.org/wiki/Modbus
-  if (at == 2)
-    return true;
+void Modbus::reset_frame_() {
+  this->rx_pos_ = 0;
+  this->rx_frame_len_ = 0;
+  this->rx_open_length_ = false;
+  this->rx_crc_ = 0xFFFF;
+  this->rx_data_crc_ = 0xFFFF;
+}
 
-  uint8_t data_len = raw[2];
-  uint8_t data_offset = 3;
+void Modbus::resync_(bool ended) {
+  // A frame that fails to parse or never completes may have been preceded by noise or by the tail of a frame that
+  // started before we listened. Instead of discarding everything, drop the first byte and feed the rest again, so a
+  // valid frame that starts later in the buffer is still found.
+  const uint16_t count = this->rx_pos_;
+  std::array<uint8_t, MAX_FRAME_SIZE> pending;
+  std::copy(this->rx_frame_.begin(), this->rx_frame_.begin() + count, pending.begin());
+  uint16_t start = 1;
+  while (start < count) {
+    this->reset_frame_();
+    uint16_t frame_start = start;
+    uint16_t i = start;
+    for (; i < count; i++) {
+      if (!this->parse_modbus_byte_(pending[i]))
+        break;
+      if (this->rx_pos_ == 0)
+        frame_start = i + 1;
+    }
+    // an incomplete frame can still be completed by the next bytes, unless the frame has ended
+    if (i == count && (!ended || this->rx_pos_ == 0))
+      return;
+    start = frame_start + 1;
+  }
+  ESP_LOGV(TAG, "Clearing buffer of %d bytes - no frame found", count);
+  this->reset_frame_();
+}
 
+bool Modbus::update_frame_length_() {
+  const uint8_t function_code = this->rx_frame_[1];
   // Per https://modbus.org/docs/Modbus_Application_Protocol_V1_1b3.pdf Ch 5 User-Defined function codes
   if (((function_code >= 65) && (function_code <= 72)) || ((function_code >= 100) && (function_code <= 110))) {
-    // Handle user-defined function, since we don't know how big this ought to be,
-    // ideally we should delegate the entire length detection to whatever handler is
-    // installed, but wait, there is the CRC, and if we get a hit there is a good
-    // chance that this is a complete message ... admittedly there is a small chance is
-    // isn't but that is quite small given the purpose of the CRC in the first place
-
-    // Fewer than 2 bytes can't calc CRC
-    if (at < 2)
-      return true;
-
-    data_len = at - 2;
-    data_offset = 1;
-
-    uint16_t computed_crc = crc16(raw, data_offset + data_len);
-    uint16_t remote_crc = uint16_t(raw[data_offset + data_len]) | (uint16_t(raw[data_offset + data_len + 1]) << 8);
-
-    if (computed_crc != remote_crc)
-      return true;
-
-    ESP_LOGD(TAG, "Modbus user-defined function %02X found", function_code);
-
-  } else {
-    // data starts at 2 and length is 4 for read registers commands
-    if (this->role == ModbusRole::SERVER && (function_code == 0x3 || function_code == 0x4)) {
-      data_offset = 2;
-      data_len = 4;
-    }
+    // Handle user-defined function, since we don't know how big this ought to be, the frame ends as soon as
+    // the running CRC over all bytes (including the trailing CRC) becomes zero
+    this->rx_open_length_ = true;
+    this->rx_data_offset_ = 1;
+    return true;
+  }
 
+  // Error ( msb indicates error )
+  // response format:  Byte[0] = device address, Byte[1] function code | 0x80 , Byte[2] exception code, Byte[3-4] crc
+  if ((function_code & 0x80) == 0x80) {
+    this->rx_frame_len_ = 2 + 1 + 2;
+    this->rx_data_offset_ = 2;
+  } else if (function_code == 0x5 || function_code == 0x06 || function_code == 0xF || function_code == 0x10) {
     // the response for write command mirrors the requests and data starts at offset 2 instead of 3 for read commands
-    if (function_code == 0x5 || function_code == 0x06 || function_code == 0xF || function_code == 0x10) {
-      data_offset = 2;
-      data_len = 4;
-    }
+    this->rx_frame_len_ = 2 + 4 + 2;
+    this->rx_data_offset_ = 2;
+  } else if (this->role == ModbusRole::SERVER && (function_code == 0x3 || function_code == 0x4)) {
+    // data starts at 2 and length is 4 for read registers commands
+    this->rx_frame_len_ = 2 + 4 + 2;
+    this->rx_data_offset_ = 2;
+  } else if (this->rx_pos_ >= 3) {
+    // Byte 2: Size (with modbus rtu function code 4/3)
+    // See also https://en.wikipedia.org/wiki/Modbus
+    this->rx_frame_len_ = 3 + this->rx_frame_[2] + 2;
+    this->rx_data_offset_ = 3;
+  }
+  return this->rx_frame_len_ <= MAX_FRAME_SIZE;
+}
 
-    // Error ( msb indicates error )
-    // response format:  Byte[0] = device address, Byte[1] function code | 0x80 , Byte[2] exception code, Byte[3-4] crc
-    if ((function_code & 0x80) == 0x80) {
-      data_offset = 2;
-      data_len = 1;
-    }
+bool Modbus::parse_modbus_byte_(uint8_t byte) {
+  ESP_LOGVV(TAG, "Modbus received Byte  %d (0X%x)", byte, byte);
+  if (this->rx_pos_ >= MAX_FRAME_SIZE)
+    return false;
+  if (this->rx_frame_len_ != 0 && this->rx_pos_ == this->rx_frame_len_ - 2)
+    this->rx_data_crc_ = this->rx_crc_;
+  this->rx_frame_[this->rx_pos_++] = byte;
+  this->rx_crc_ = crc16(&byte, 1, this->rx_crc_);
 
-    // Byte data_offset..data_offset+data_len-1: Data
-    if (at < data_offset + data_len)
+  // Byte 0: modbus address (match all)
+  if (this->rx_pos_ < 2)
+    return true;
+  if (this->rx_frame_len_ == 0 && !this->rx_open_length_) {
+    if (!this->update_frame_length_())
+      return false;
+    if (this->rx_frame_len_ == 0 && !this->rx_open_length_)
       return true;
+  }
 
-    // Byte 3+data_len: CRC_LO (over all bytes)
-    if (at == data_offset + data_len)
+  if (this->rx_open_length_) {
+    // Fewer than 2 bytes can't calc CRC
+    if (this->rx_pos_ < 4 || this->rx_crc_ != 0)
+      return true;
+    ESP_LOGD(TAG, "Modbus user-defined function %02X found", this->rx_frame_[1]);
+  } else {
+    if (this->rx_pos_ < this->rx_frame_len_)
       return true;
 
     // Byte data_offset+len+1: CRC_HI (over all bytes)
-    uint16_t computed_crc = crc16(raw, data_offset + data_len);
-    uint16_t remote_crc = uint16_t(raw[data_offset + data_len]) | (uint16_t(raw[data_offset + data_len + 1]) << 8);
-    if (computed_crc != remote_crc) {
+    if (this->rx_crc_ != 0) {
+      // the received CRC is sent low byte first
       if (this->disable_crc_) {
-        ESP_LOGD(TAG, "Modbus CRC Check failed, but ignored! %02X!=%02X", computed_crc, remote_crc);
+        ESP_LOGD(TAG, "Modbus CRC Check failed, but ignored! %02X!=%02X", this->rx_data_crc_,
+                 encode_uint16(this->rx_frame_[this->rx_pos_ - 1], this->rx_frame_[this->rx_pos_ - 2]));
       } else {
-        ESP_LOGW(TAG, "Modbus CRC Check failed! %02X!=%02X", computed_crc, remote_crc);
+        ESP_LOGW(TAG, "Modbus CRC Check failed! %02X!=%02X", this->rx_data_crc_,
+                 encode_uint16(this->rx_frame_[this->rx_pos_ - 1], this->rx_frame_[this->rx_pos_ - 2]));
         return false;
       }
     }
   }
-  std::vector<uint8_t> data(this->rx_buffer_.begin() + data_offset, this->rx_buffer_.begin() + data_offset + data_len);
+
+  this->handle_frame_();
+  // reset buffer
+  ESP_LOGV(TAG, "Clearing buffer of %d bytes - parse succeeded", this->rx_pos_);
+  this->reset_frame_();
+  return true;
+}
+
+void Modbus::handle_frame_() {
+  const uint8_t *raw = this->rx_frame_.data();
+  const uint8_t address = raw[0];
+  const uint8_t function_code = raw[1];
+  this->rx_data_.assign(raw + this->rx_data_offset_, raw + this->rx_pos_ - 2);
+  const auto &data = this->rx_data_;
+
   bool found = false;
   for (auto *device : this->devices_) {
     if (device->address_ == address) {
@@ -154,10 +234,26 @@ bool Modbus::parse_modbus_byte_(uint8_t byte) {
   if (!found) {
     ESP_LOGW(TAG, "Got Modbus frame from unknown address 0x%02X! ", address);
   }
+}
 
-  // reset buffer
-  ESP_LOGV(TAG, "Clearing buffer of %d bytes - parse succeeded", at);
-  this->rx_buffer_.clear();
+bool Modbus::is_next_sender(ModbusDevice *device) {
+  const size_t count = this->devices_.size();
+  int best_priority = -1;
+  size_t best = count;
+  for (size_t i = 0; i < count; i++) {
+    const size_t index = (this->next_sender_ + i) % count;
+    const int priority = this->devices_[index]->get_pending_priority();
+    if (priority > best_priority) {
+      best_priority = priority;
+      best = index;
+    }
+  }
+  // nobody else is waiting
+  if (best == count)
+    return true;
+  if (this->devices_[best] != device)
+    return false;
+  this->next_sender_ = best + 1;
   return true;
 }
 
@@ -165,6 +261,7 @@ void Modbus::dump_config() {
   ESP_LOGCONFIG(TAG, "Modbus:");
   LOG_PIN("  Flow Control Pin: ", this->flow_control_pin_);
   ESP_LOGCONFIG(TAG, "  Send Wait Time: %d ms", this->send_wait_time_);
+  ESP_LOGCONFIG(TAG, "  Inter-frame Gap: %" PRIu32 " us", this->inter_frame_us_);
   ESP_LOGCONFIG(TAG, "  CRC Disabled: %s", YESNO(this->disable_crc_));
 }
 float Modbus::get_setup_priority() const {
@@ -3,11 +3,15 @@
 #include "esphome/core/component.h"
 #include "esphome/components/uart/uart.h"
 
+#include <array>
 #include <vector>
 
 namespace esphome {
 namespace modbus {
 
+/// Maximum size of a Modbus RTU frame (address + PDU + CRC).
+static const size_t MAX_FRAME_SIZE = 256;
+
 enum ModbusRole {
   CLIENT,
   SERVER,
@@ -26,6 +30,8 @@ class Modbus : public uart::UARTDevice, public Component {
   void dump_config() override;
 
   void register_device(ModbusDevice *device) { this->devices_.push_back(device); }
+  /// Round-robin arbitration between devices that queue their commands, the highest pending priority goes first.
+  bool is_next_sender(ModbusDevice *device);
 
   float get_setup_priority() const override;
 
@@ -37,19 +43,50 @@ class Modbus : public uart::UARTDevice, public Component {
   uint8_t waiting_for_response{0};
   void set_send_wait_time(uint16_t time_in_ms) { send_wait_time_ = time_in_ms; }
   void set_disable_crc(bool disable_crc) { disable_crc_ = disable_crc; }
+  /// Time to transfer one character on the bus, including start, parity and stop bits.
+  uint32_t get_char_time_us() const;
+  /// Minimum bus silence between two frames.
+  uint32_t get_inter_frame_us() const { return this->inter_frame_us_; }
 
   ModbusRole role;
 
  protected:
   GPIOPin *flow_control_pin_{nullptr};
 
+  /// Feed one received byte into the frame state machine, returns false if the frame has to be discarded.
   bool parse_modbus_byte_(uint8_t byte);
+  /// Determine the total frame length once address and function code (and byte count) are known.
+  bool update_frame_length_();
+  void handle_frame_();
+  void reset_frame_();
+  /// Re-parse the buffered bytes after a parse failure, starting one byte later each time until they fit. If
+  /// @p ended, no more bytes belong to the frame and an incomplete frame does not fit either.
+  void resync_(bool ended);
   uint16_t send_wait_time_{250};
   bool disable_crc_;
-  std::vector<uint8_t> rx_buffer_;
+  /// Minimum bus silence (3.5 character times) that separates two frames.
+  uint32_t inter_frame_us_{0};
+  std::array<uint8_t, MAX_FRAME_SIZE> rx_frame_{};
+  uint16_t rx_pos_{0};
+  /// Expected total frame length including CRC, 0 while not yet known.
+  uint16_t rx_frame_len_{0};
+  uint8_t rx_data_offset_{3};
+  bool rx_open_length_{false};
+  /// CRC over all bytes received so far; over a complete frame including its CRC this is 0.
+  uint16_t rx_crc_{0xFFFF};
+  /// CRC over the frame without its CRC bytes, for diagnostics.
+  uint16_t rx_data_crc_{0xFFFF};
+  std::vector<uint8_t> rx_data_;
   uint32_t last_modbus_byte_{0};
+  /// micros() of the first and the latest poll that found no data since bytes were last read.
+  uint32_t first_idle_us_{0};
+  uint32_t last_idle_us_{0};
+  /// Polls without data since bytes were last read, saturating at 2.
+  uint8_t idle_polls_{0};
   uint32_t last_send_{0};
   std::vector<ModbusDevice *> devices_;
+  /// Index in devices_ where the next arbitration round starts
+  size_t next_sender_{0};
 };
 
 class ModbusDevice {
@@ -59,6 +96,8 @@ class ModbusDevice {
   virtual void on_modbus_data(const std::vector<uint8_t> &data) = 0;
   virtual void on_modbus_error(uint8_t function_code, uint8_t exception_code) {}
   virtual void on_modbus_read_registers(uint8_t function_code, uint16_t start_address, uint16_t number_of_registers){};
+  /// Priority of the next queued command that is ready to be sent, negative if there is none.
+  virtual int get_pending_priority() { return -1; }
   void send(uint8_t function, uint16_t start_address, uint16_t number_of_entities, uint8_t payload_len = 0,
             const uint8_t *payload = nullptr) {
     this->parent_->send(this->address_, function, start_address, number_of_entities, payload_len, payload);
@@ -22,6 +22,8 @@ from .const import (
     CONF_CUSTOM_COMMAND,
     CONF_FORCE_NEW_RANGE,
     CONF_MAX_CMD_RETRIES,
+    CONF_MAX_REGISTER_GAP,
+    CONF_MAX_REGISTERS_PER_REQUEST,
     CONF_MODBUS_CONTROLLER_ID,
     CONF_OFFLINE_SKIP_UPDATES,
     CONF_ON_COMMAND_SENT,
@@ -29,6 +31,7 @@ from .const import (
     CONF_ON_OFFLINE,
     CONF_REGISTER_COUNT,
     CONF_REGISTER_TYPE,
+    CONF_REQUEST_LATENCY,
     CONF_RESPONSE_SIZE,
     CONF_SKIP_UPDATES,
     CONF_VALUE_TYPE,
@@ -42,6 +45,9 @@ CONF_READ_LAMBDA = "read_lambda"
 CONF_SERVER_REGISTERS = "server_registers"
 MULTI_CONF = True
 
+# Matches ModbusController::REGISTER_GAP_AUTO
+REGISTER_GAP_AUTO = -1
+
 modbus_controller_ns = cg.esphome_ns.namespace("modbus_controller")
 ModbusController = modbus_controller_ns.class_(
     "ModbusController", cg.PollingComponent, modbus.ModbusDevice
@@ -146,6 +152,15 @@ CONFIG_SCHEMA = cv.All(
             ): cv.positive_time_period_milliseconds,
             cv.Optional(CONF_MAX_CMD_RETRIES, default=4): cv.positive_int,
             cv.Optional(CONF_OFFLINE_SKIP_UPDATES, default=0): cv.positive_int,
+            cv.Optional(CONF_MAX_REGISTER_GAP, default=0): cv.Any(
+                cv.one_of("auto", lower=True), cv.int_range(min=0, max=124)
+            ),
+            cv.Optional(CONF_MAX_REGISTERS_PER_REQUEST): cv.int_range(
+                min=1, max=125
+            ),
+            cv.Optional(
+                CONF_REQUEST_LATENCY, default="10ms"
+            ): cv.positive_time_period_milliseconds,
             cv.Optional(
                 CONF_SERVER_REGISTERS,
             ): cv.ensure_list(ModbusServerRegisterSchema),
@@ -283,6 +298,15 @@ async def to_code(config):
     cg.add(var.set_command_throttle(config[CONF_COMMAND_THROTTLE]))
     cg.add(var.set_max_cmd_retries(config[CONF_MAX_CMD_RETRIES]))
     cg.add(var.set_offline_skip_updates(config[CONF_OFFLINE_SKIP_UPDATES]))
+    if config[CONF_MAX_REGISTER_GAP] == "auto":
+        cg.add(var.set_max_register_gap(REGISTER_GAP_AUTO))
+    else:
+        cg.add(var.set_max_register_gap(config[CONF_MAX_REGISTER_GAP]))
+    if CONF_MAX_REGISTERS_PER_REQUEST in config:
+        cg.add(
+            var.set_max_registers_per_request(config[CONF_MAX_REGISTERS_PER_REQUEST])
+        )
+    cg.add(var.set_request_latency(config[CONF_REQUEST_LATENCY]))
     if CONF_SERVER_REGISTERS in config:
         for server_register in config[CONF_SERVER_REGISTERS]:
             cg.add(
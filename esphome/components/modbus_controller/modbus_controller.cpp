@@ -1,12 +1,46 @@
 #include "modbus_controller.h"
-#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 
+#include <cinttypes>
+
 namespace esphome {
 namespace modbus_controller {
 
 static const char *const TAG = "modbus_controller";
 
+/// Largest number of registers a read holding/input registers request (function code 3/4) may ask for
+static const uint16_t MAX_READ_REGISTERS = 125;
+
+// Size of the request frame on the wire (address, function code, PDU, CRC)
+static size_t request_frame_size(const ModbusCommandItem &command) {
+  switch (command.function_code) {
+    case ModbusFunctionCode::CUSTOM:
+      return command.payload.size() + 2;
+    case ModbusFunctionCode::WRITE_MULTIPLE_COILS:
+    case ModbusFunctionCode::WRITE_MULTIPLE_REGISTERS:
+      return 9 + command.payload.size();
+    default:
+      return 8;
+  }
+}
+
+// Bytes of a response frame that are not part of the data passed to on_modbus_data (address, function code, byte
+// count and CRC); write responses echo the request and have no byte count
+static size_t response_framing_size(const ModbusCommandItem *command) {
+  if (command == nullptr)
+    return 5;
+  switch (command->function_code) {
+    case ModbusFunctionCode::WRITE_SINGLE_COIL:
+    case ModbusFunctionCode::WRITE_SINGLE_REGISTER:
+    case ModbusFunctionCode::WRITE_MULTIPLE_COILS:
+    case ModbusFunctionCode::WRITE_MULTIPLE_REGISTERS:
+      return 4;
+    default:
+      return 5;
+  }
+}
+
 void ModbusController::setup() { this->create_register_ranges_(); }
 
 /*
@@ -18,7 +52,8 @@ void ModbusController::setup() { this->create_register_ranges_(); }
 bool ModbusController::send_next_command_() {
   uint32_t last_send = millis() - this->last_command_timestamp_;
 
-  if ((last_send > this->command_throttle_) && !waiting_for_response() && !this->command_queue_.empty()) {
+  if ((last_send > this->command_throttle_) && !waiting_for_response() && !this->command_queue_.empty() &&
+      this->parent_->is_next_sender(this)) {
     auto &command = this->command_queue_.front();
 
     // remove from queue if command was sent too often
@@ -38,6 +73,8 @@ bool ModbusController::send_next_command_() {
       }
       ESP_LOGD(TAG, "Modbus command to device=%d register=0x%02X no response received - removed from send queue",
                this->address_, command->register_address);
+      this->statistics_.timeouts++;
+      this->request_in_flight_ = false;
       this->command_queue_.pop_front();
     } else {
       ESP_LOGV(TAG, "Sending next modbus command to device %d register 0x%02X count %d", this->address_,
@@ -45,6 +82,10 @@ bool ModbusController::send_next_command_() {
       command->send();
 
       this->last_command_timestamp_ = millis();
+      this->command_sent_us_ = micros();
+      this->request_in_flight_ = true;
+      this->statistics_.requests++;
+      this->statistics_.bytes_sent += request_frame_size(*command);
 
       this->command_sent_callback_.call((int) command->function_code, command->register_address);
 
@@ -60,6 +101,8 @@ bool ModbusController::send_next_command_() {
 // Queue incoming response
 void ModbusController::on_modbus_data(const std::vector<uint8_t> &data) {
   auto &current_command = this->command_queue_.front();
+  this->statistics_.bytes_received += data.size() + response_framing_size(current_command.get());
+  this->count_response_time_();
   if (current_command != nullptr) {
     if (this->module_offline_) {
       ESP_LOGW(TAG, "Modbus device=%d back online", this->address_);
@@ -83,6 +126,14 @@ void ModbusController::on_modbus_data(const std::vector<uint8_t> &data) {
   }
 }
 
+void ModbusController::count_response_time_() {
+  // unsolicited frames (e.g. responses to another master) don't keep this controller's requests busy
+  if (!this->request_in_flight_)
+    return;
+  this->statistics_.busy_us += micros() - this->command_sent_us_;
+  this->request_in_flight_ = false;
+}
+
 // Dispatch the response to the registered handler
 void ModbusController::process_modbus_data_(const ModbusCommandItem *response) {
   ESP_LOGV(TAG, "Process modbus response for address 0x%X size: %zu", response->register_address,
@@ -92,6 +143,8 @@ void ModbusController::process_modbus_data_(const ModbusCommandItem *response) {
 
 void ModbusController::on_modbus_error(uint8_t function_code, uint8_t exception_code) {
   ESP_LOGE(TAG, "Modbus error function code: 0x%X exception: %d ", function_code, exception_code);
+  this->statistics_.bytes_received += 5;
+  this->count_response_time_();
   // Remove pending command waiting for a response
   auto &current_command = this->command_queue_.front();
   if (current_command != nullptr) {
@@ -176,12 +229,24 @@ void ModbusController::on_register_data(ModbusRegisterType register_type, uint16
   }
 }
 
+int ModbusController::get_pending_priority() {
+  if (this->command_queue_.empty() || millis() - this->last_command_timestamp_ <= this->command_throttle_)
+    return -1;
+  return static_cast<int>(this->command_queue_.front()->priority);
+}
+
 void ModbusController::queue_command(const ModbusCommandItem &command) {
-  if (!this->allow_duplicate_commands_) {
+  // the same read for the sensors is never useful twice, duplicate writes are only dropped if not allowed. Reads with
+  // their own handler are always queued, dropping them would drop the handler.
+  const bool is_read = command.is_read();
+  if ((is_read && command.default_handler) || (!is_read && !this->allow_duplicate_commands_)) {
     // check if this command is already qeued.
     // not very effective but the queue is never really large
-    for (auto &item : this->command_queue_) {
-      if (item->is_equal(command)) {
+    for (auto it = this->command_queue_.begin(); it != this->command_queue_.end(); ++it) {
+      auto &item = *it;
+      if (!item->is_equal(command) || (is_read && !item->default_handler))
+        continue;
+      if (!is_read) {
         ESP_LOGW(TAG, "Duplicate modbus command found: type=0x%x address=%u count=%u",
                  static_cast<uint8_t>(command.register_type), command.register_address, command.register_count);
         // update the payload of the queued command
@@ -189,9 +254,21 @@ void ModbusController::queue_command(const ModbusCommandItem &command) {
         item->payload = command.payload;
         return;
       }
+      ESP_LOGV(TAG, "Read of address=%u count=%u already queued", command.register_address, command.register_count);
+      if (item->is_sent() || item->priority >= command.priority)
+        return;
+      // requeue the pending read with the higher priority
+      this->command_queue_.erase(it);
+      break;
     }
   }
-  this->command_queue_.push_back(make_unique<ModbusCommandItem>(command));
+  // insert behind all commands with the same or a higher priority, the command in flight always stays in front
+  auto pos = this->command_queue_.begin();
+  if (pos != this->command_queue_.end() && (*pos)->is_sent())
+    ++pos;
+  while (pos != this->command_queue_.end() && (*pos)->priority >= command.priority)
+    ++pos;
+  this->command_queue_.insert(pos, make_unique<ModbusCommandItem>(command));
 }
 
 void ModbusController::update_range_(RegisterRange &r) {
@@ -211,10 +288,14 @@ void ModbusController::update_range_(RegisterRange &r) {
         command_item.register_address = (*sensor)->start_address;
         command_item.register_count = (*sensor)->register_count;
         command_item.function_code = ModbusFunctionCode::CUSTOM;
+        command_item.priority = ModbusCommandPriority::PERIODIC_READ;
         queue_command(command_item);
       }
     } else {
-      queue_command(ModbusCommandItem::create_read_command(this, r.register_type, r.start_address, r.register_count));
+      auto command_item =
+          ModbusCommandItem::create_read_command(this, r.register_type, r.start_address, r.register_count);
+      command_item.priority = ModbusCommandPriority::PERIODIC_READ;
+      queue_command(command_item);
     }
     r.skip_updates_counter = r.skip_updates;  // reset counter to config value
   } else {
@@ -232,12 +313,45 @@ void ModbusController::update() {
     ESP_LOGV(TAG, "Updating modbus component");
   }
 
+  const uint32_t now = millis();
+  if (this->last_update_ != 0 && now != this->last_update_) {
+    this->bus_utilization_ = this->statistics_.busy_us / ((now - this->last_update_) * 10.0f);
+    if (this->statistics_.requests > 0) {
+      ESP_LOGD(TAG,
+               "Bus usage device=%d: %" PRIu32 " requests, %" PRIu32 " timeouts, %" PRIu32 "/%" PRIu32
+               " bytes sent/received, %.1f%% busy",
+               this->address_, this->statistics_.requests, this->statistics_.timeouts, this->statistics_.bytes_sent,
+               this->statistics_.bytes_received, this->bus_utilization_);
+    }
+  }
+  this->last_update_ = now;
+  this->last_statistics_ = this->statistics_;
+  this->statistics_ = {};
+
   for (auto &r : this->register_ranges_) {
     ESP_LOGVV(TAG, "Updating range 0x%X", r.start_address);
     update_range_(r);
   }
 }
 
+uint16_t ModbusController::get_register_gap_() const {
+  if (this->max_register_gap_ != REGISTER_GAP_AUTO)
+    return this->max_register_gap_;
+  const uint32_t char_time = this->parent_->get_char_time_us();
+  if (char_time == 0)
+    return 0;
+  // Every request costs its own frame (8 bytes), the response framing (5 bytes), two inter-frame gaps and the
+  // time until the device answers (or the command throttle if that is longer). A register in a gap costs 2 bytes
+  // of response, so reading the gap is cheaper as long as it is shorter than request cost / 2 characters.
+  const uint32_t request_cost = 13 * char_time + 2 * this->parent_->get_inter_frame_us() +
+                                std::max(this->request_latency_, this->command_throttle_) * 1000UL;
+  const uint32_t gap = request_cost / (2 * char_time);
+  if (this->max_registers_per_request_ != 0)
+    return std::min<uint32_t>(gap, this->max_registers_per_request_);
+  // same bound as a configured max_register_gap
+  return std::min<uint32_t>(gap, 124);
+}
+
 // walk through the sensors and determine the register ranges to read
 size_t ModbusController::create_register_ranges_() {
   this->register_ranges_.clear();
@@ -249,8 +363,11 @@ size_t ModbusController::create_register_ranges_() {
   // iterator is sorted see SensorItemsComparator for details
   auto ix = this->sensorset_.begin();
   RegisterRange r = {};
-  uint8_t buffer_offset = 0;
+  uint16_t buffer_offset = 0;
   SensorItem *prev = nullptr;
+  const uint16_t max_gap = this->get_register_gap_();
+  // gaps are only bridged between sensors that are polled at the same rate
+  bool uniform_skip = true;
   while (ix != this->sensorset_.end()) {
     SensorItem *curr = *ix;
 
@@ -266,11 +383,18 @@ size_t ModbusController::create_register_ranges_() {
       r.skip_updates = curr->skip_updates;
       r.skip_updates_counter = 0;
       buffer_offset = curr->get_register_size();
+      uniform_skip = true;
 
       ESP_LOGV(TAG, "Started new range");
     } else {
       // this is not the first register in range so it might be possible
       // to reuse the last register or extend the current range
+      const bool is_register = curr->register_type == ModbusRegisterType::HOLDING ||
+                               curr->register_type == ModbusRegisterType::READ;
+      const uint16_t range_end = r.start_address + r.register_count;
+      const bool fits = !is_register || this->max_registers_per_request_ == 0 ||
+                        curr->start_address + curr->register_count - r.start_address <=
+                            this->max_registers_per_request_;
       if (!curr->force_new_range && r.register_type == curr->register_type &&
           curr->register_type != ModbusRegisterType::CUSTOM) {
         if (curr->start_address == (r.start_address + r.register_count - prev->register_count) &&
@@ -289,7 +413,7 @@ size_t ModbusController::create_register_ranges_() {
 
           ESP_LOGV(TAG, "Re-use previous register - change to register: 0x%X %d offset=%u", curr->start_address,
                    curr->register_count, curr->offset);
-        } else if (curr->start_address == (r.start_address + r.register_count)) {
+        } else if (curr->start_address == range_end && fits) {
           // this register can extend the current range
 
           // remove this sensore because start_address is changed (sort-order)
@@ -306,11 +430,37 @@ size_t ModbusController::create_register_ranges_() {
 
           ESP_LOGV(TAG, "Extend range - change to register: 0x%X %d offset=%u", curr->start_address,
                    curr->register_count, curr->offset);
+        } else if (is_register && fits && curr->start_address > range_end &&
+                   curr->start_address - range_end <= max_gap &&
+                   curr->start_address + curr->register_count - r.start_address <= MAX_READ_REGISTERS && uniform_skip &&
+                   curr->skip_updates == r.skip_updates && curr->response_bytes == 0 &&
+                   buffer_offset == r.register_count * 2) {
+          // reading the unused registers in between is cheaper than another request
+
+          // remove this sensore because start_address is changed (sort-order)
+          ix = this->sensorset_.erase(ix);
+
+          const uint16_t gap = curr->start_address - range_end;
+          buffer_offset += gap * 2;
+          curr->start_address = r.start_address;
+          curr->offset += buffer_offset;
+          buffer_offset += curr->get_register_size();
+          r.register_count += gap + curr->register_count;
+          r.gap_registers += gap;
+
+          this->sensorset_.insert(curr);
+          // move iterator backwards because it will be incremented later
+          ix--;
+
+          ESP_LOGV(TAG, "Bridge gap of %u registers - change to register: 0x%X %d offset=%u", gap,
+                   curr->start_address, curr->register_count, curr->offset);
         }
       }
     }
 
     if (curr->start_address == r.start_address && curr->register_type == r.register_type) {
+      if (curr->skip_updates != r.skip_updates)
+        uniform_skip = false;
       // use the lowest non zero value for the whole range
       // Because zero is the default value for skip_updates it is excluded from getting the min value.
       if (curr->skip_updates != 0) {
@@ -350,6 +500,12 @@ void ModbusController::dump_config() {
   ESP_LOGCONFIG(TAG, "  Address: 0x%02X", this->address_);
   ESP_LOGCONFIG(TAG, "  Max Command Retries: %d", this->max_cmd_retries_);
   ESP_LOGCONFIG(TAG, "  Offline Skip Updates: %d", this->offline_skip_updates_);
+  uint32_t gap_registers = 0;
+  for (auto &r : this->register_ranges_)
+    gap_registers += r.gap_registers;
+  ESP_LOGCONFIG(TAG, "  Max Register Gap: %u", this->get_register_gap_());
+  ESP_LOGCONFIG(TAG, "  Read Ranges: %zu (%" PRIu32 " unused registers read)", this->register_ranges_.size(),
+                gap_registers);
 #if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_VERBOSE
   ESP_LOGCONFIG(TAG, "sensormap");
   for (auto &it : this->sensorset_) {
@@ -359,8 +515,9 @@ void ModbusController::dump_config() {
   }
   ESP_LOGCONFIG(TAG, "ranges");
   for (auto &it : this->register_ranges_) {
-    ESP_LOGCONFIG(TAG, "  Range type=%zu start=0x%X count=%d skip_updates=%d", static_cast<uint8_t>(it.register_type),
-                  it.start_address, it.register_count, it.skip_updates);
+    ESP_LOGCONFIG(TAG, "  Range type=%zu start=0x%X count=%d gap=%d skip_updates=%d",
+                  static_cast<uint8_t>(it.register_type), it.start_address, it.register_count, it.gap_registers,
+                  it.skip_updates);
   }
   ESP_LOGCONFIG(TAG, "server registers");
   for (auto &r : this->server_registers_) {
@@ -372,16 +529,14 @@ void ModbusController::dump_config() {
 
 void ModbusController::loop() {
   // Incoming data to process?
-  if (!this->incoming_queue_.empty()) {
+  while (!this->incoming_queue_.empty()) {
     auto &message = this->incoming_queue_.front();
     if (message != nullptr)
       this->process_modbus_data_(message.get());
     this->incoming_queue_.pop();
-
-  } else {
-    // all messages processed send pending commands
-    this->send_next_command_();
   }
+  // all messages processed send pending commands
+  this->send_next_command_();
 }
 
 void ModbusController::on_write_register_response(ModbusRegisterType register_type, uint16_t start_address,
@@ -405,6 +560,7 @@ ModbusCommandItem ModbusCommandItem::create_read_command(
   cmd.modbusdevice = modbusdevice;
   cmd.register_type = register_type;
   cmd.function_code = modbus_register_read_function(register_type);
+  cmd.priority = ModbusCommandPriority::READ;
   cmd.register_address = start_address;
   cmd.register_count = register_count;
   cmd.on_data_func = std::move(handler);
@@ -418,12 +574,14 @@ ModbusCommandItem ModbusCommandItem::create_read_command(ModbusController *modbu
   cmd.modbusdevice = modbusdevice;
   cmd.register_type = register_type;
   cmd.function_code = modbus_register_read_function(register_type);
+  cmd.priority = ModbusCommandPriority::READ;
   cmd.register_address = start_address;
   cmd.register_count = register_count;
   cmd.on_data_func = [modbusdevice](ModbusRegisterType register_type, uint16_t start_address,
                                     const std::vector<uint8_t> &data) {
     modbusdevice->on_register_data(register_type, start_address, data);
   };
+  cmd.default_handler = true;
   return cmd;
 }
 
@@ -570,6 +728,18 @@ bool ModbusCommandItem::send() {
   return true;
 }
 
+bool ModbusCommandItem::is_read() const {
+  switch (this->function_code) {
+    case ModbusFunctionCode::READ_COILS:
+    case ModbusFunctionCode::READ_DISCRETE_INPUTS:
+    case ModbusFunctionCode::READ_HOLDING_REGISTERS:
+    case ModbusFunctionCode::READ_INPUT_REGISTERS:
+      return true;
+    default:
+      return false;
+  }
+}
+
 bool ModbusCommandItem::is_equal(const ModbusCommandItem &other) {
   // for custom commands we have to check for identical payloads, since
   // address/count/type fields will be set to zero
@@ -46,6 +46,13 @@ enum class ModbusRegisterType : uint8_t {
   READ = 0x04,
 };
 
+/// Order in which queued commands are sent, commands with the same priority are sent in FIFO order
+enum class ModbusCommandPriority : uint8_t {
+  PERIODIC_READ = 0,  // reads queued by update()
+  READ = 1,           // reads requested on demand
+  WRITE = 2,          // writes and custom commands
+};
+
 enum class SensorValueType : uint8_t {
   RAW = 0x00,     // variable length
   U_WORD = 0x1,   // 1 Register unsigned
@@ -307,6 +314,17 @@ struct RegisterRange {
   uint16_t skip_updates;          // the config value
   SensorSet sensors;              // all sensors of this range
   uint16_t skip_updates_counter;  // the running value
+  uint8_t gap_registers;          // registers read only to avoid a separate request
+};
+
+/// Bus usage of one controller, accumulated between two updates
+struct BusStatistics {
+  uint32_t requests{0};
+  uint32_t timeouts{0};
+  uint32_t bytes_sent{0};
+  uint32_t bytes_received{0};
+  /// time from sending a request until its response was received
+  uint32_t busy_us{0};
 };
 
 class ModbusCommandItem {
@@ -317,12 +335,20 @@ class ModbusCommandItem {
   uint16_t register_count{0};
   ModbusFunctionCode function_code{ModbusFunctionCode::CUSTOM};
   ModbusRegisterType register_type{ModbusRegisterType::CUSTOM};
+  ModbusCommandPriority priority{ModbusCommandPriority::WRITE};
   std::function<void(ModbusRegisterType register_type, uint16_t start_address, const std::vector<uint8_t> &data)>
       on_data_func;
+  /// on_data_func is the default handler that passes the data to the sensors (on_register_data), so two such reads
+  /// of the same registers are interchangeable
+  bool default_handler{false};
   std::vector<uint8_t> payload = {};
   bool send();
   /// Check if the command should be retried based on the max_retries parameter
   bool should_retry(uint8_t max_retries) { return this->send_count_ <= max_retries; };
+  /// Check if the command has been sent at least once and is waiting for its response
+  bool is_sent() const { return this->send_count_ > 0; }
+  /// Check if the command only reads data
+  bool is_read() const;
 
   /// factory methods
   /** Create modbus read command
@@ -446,6 +472,8 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   void on_modbus_error(uint8_t function_code, uint8_t exception_code) override;
   /// called when a modbus request (function code 3 or 4) was parsed without errors
   void on_modbus_read_registers(uint8_t function_code, uint16_t start_address, uint16_t number_of_registers) final;
+  /// priority of the next command in the send queue if it can be sent now
+  int get_pending_priority() override;
   /// default delegate called by process_modbus_data when a response has retrieved from the incoming queue
   void on_register_data(ModbusRegisterType register_type, uint16_t start_address, const std::vector<uint8_t> &data);
   /// default delegate called by process_modbus_data when a response for a write response has retrieved from the
@@ -476,15 +504,32 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   void set_max_cmd_retries(uint8_t max_cmd_retries) { this->max_cmd_retries_ = max_cmd_retries; }
   /// get how many times a command will be (re)sent if no response is received
   uint8_t get_max_cmd_retries() { return this->max_cmd_retries_; }
+  /// called by esphome generated code to set the largest gap of unused registers read to merge two ranges,
+  /// REGISTER_GAP_AUTO derives it from the bus speed and request latency
+  void set_max_register_gap(int16_t max_register_gap) { this->max_register_gap_ = max_register_gap; }
+  /// called by esphome generated code to set the maximum number of registers read with a single request
+  void set_max_registers_per_request(uint8_t max_registers) { this->max_registers_per_request_ = max_registers; }
+  /// called by esphome generated code to set the expected time a device needs to answer a request
+  void set_request_latency(uint16_t request_latency) { this->request_latency_ = request_latency; }
+  /// get the bus usage collected during the last update interval
+  const BusStatistics &get_bus_statistics() const { return this->last_statistics_; }
+  /// get the fraction of the last update interval (0-100%) the bus was busy with requests of this controller
+  float get_bus_utilization() const { return this->bus_utilization_; }
+
+  static const int16_t REGISTER_GAP_AUTO = -1;
 
  protected:
   /// parse sensormap_ and create range of sequential addresses
   size_t create_register_ranges_();
+  /// largest number of unused registers worth reading instead of sending another request
+  uint16_t get_register_gap_() const;
   // find register in sensormap. Returns iterator with all registers having the same start address
   SensorSet find_sensors_(ModbusRegisterType register_type, uint16_t start_address) const;
   /// submit the read command for the address range to the send queue
   void update_range_(RegisterRange &r);
   /// parse incoming modbus data
+  /// add the time since the last request was sent to the busy time, if it is still waiting for a response
+  void count_response_time_();
   void process_modbus_data_(const ModbusCommandItem *response);
   /// send the next modbus command from the send queue
   bool send_next_command_();
@@ -496,7 +541,7 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   std::vector<ServerRegister *> server_registers_{};
   /// Continuous range of modbus registers
   std::vector<RegisterRange> register_ranges_{};
-  /// Hold the pending requests to be sent
+  /// Hold the pending requests to be sent, ordered by priority. The front is the command waiting for a response.
   std::list<std::unique_ptr<ModbusCommandItem>> command_queue_;
   /// modbus response data waiting to get processed
   std::queue<std::unique_ptr<ModbusCommandItem>> incoming_queue_;
@@ -512,6 +557,20 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   uint16_t offline_skip_updates_{0};
   /// How many times we will retry a command if we get no response
   uint8_t max_cmd_retries_{4};
+  /// largest gap between two ranges that is read to merge them, REGISTER_GAP_AUTO to use the cost model
+  int16_t max_register_gap_{0};
+  /// largest range of holding/input registers read with a single request, 0 for no limit
+  uint8_t max_registers_per_request_{0};
+  /// expected response time of the device in ms
+  uint16_t request_latency_{10};
+  /// bus usage since the last update
+  BusStatistics statistics_{};
+  BusStatistics last_statistics_{};
+  float bus_utilization_{0};
+  uint32_t last_update_{0};
+  uint32_t command_sent_us_{0};
+  /// a request was sent and neither its response nor an error has been received yet
+  bool request_in_flight_{false};
   /// Command sent callback
   CallbackManager<void(int, int)> command_sent_callback_{};
   /// Server online callback
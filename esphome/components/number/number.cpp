@@ -13,9 +13,5 @@ void Number::publish_state(float state) {
   this->state_callback_.call(state);
 }
 
-void Number::add_on_state_callback(std::function<void(float)> &&callback) {
-  this->state_callback_.add(std::move(callback));
-}
-
 }  // namespace number
 }  // namespace esphome
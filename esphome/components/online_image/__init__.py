@@ -28,6 +28,7 @@ MULTI_CONF = True
 
 CONF_ON_DOWNLOAD_FINISHED = "on_download_finished"
 CONF_PLACEHOLDER = "placeholder"
+CONF_PROGRESSIVE = "progressive"
 
 _LOGGER = logging.getLogger(__name__)
 
@@ -76,6 +77,7 @@ ONLINE_IMAGE_SCHEMA = cv.Schema(
         cv.Required(CONF_FORMAT): cv.enum(IMAGE_FORMAT, upper=True),
         cv.Optional(CONF_PLACEHOLDER): cv.use_id(Image_),
         cv.Optional(CONF_BUFFER_SIZE, default=2048): cv.int_range(256, 65536),
+        cv.Optional(CONF_PROGRESSIVE, default=False): cv.boolean,
         cv.Optional(CONF_ON_DOWNLOAD_FINISHED): automation.validate_automation(
             {
                 cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(DownloadFinishedTrigger),
@@ -154,6 +156,7 @@ async def to_code(config):
     await cg.register_parented(var, config[CONF_HTTP_REQUEST_ID])
 
     cg.add(var.set_transparency(transparent))
+    cg.add(var.set_progressive(config[CONF_PROGRESSIVE]))
 
     if placeholder_id := config.get(CONF_PLACEHOLDER):
         placeholder = await cg.get_variable(placeholder_id)
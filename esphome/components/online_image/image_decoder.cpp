@@ -22,6 +22,7 @@ void ImageDecoder::draw(int x, int y, int w, int h, const Color &color) {
       this->image_->draw_pixel_(i, j, color);
     }
   }
+  this->image_->set_decoded_rows_(height);
 }
 
 uint8_t *DownloadBuffer::data(size_t offset) {
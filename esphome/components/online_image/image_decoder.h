@@ -65,6 +65,11 @@ class ImageDecoder {
 
   bool is_finished() const { return this->decoded_bytes_ == this->download_size_; }
 
+  /// Fraction of the download that has been decoded so far, 0 if the download size is unknown.
+  float get_progress() const {
+    return this->download_size_ == 0 ? 0.0f : static_cast<float>(this->decoded_bytes_) / this->download_size_;
+  }
+
  protected:
   OnlineImage *image_;
   // Initializing to 1, to ensure it is different than initial "decoded_bytes_".
@@ -82,6 +82,7 @@ bool OnlineImage::resize_(int width_in, int height_in) {
   } else {
     ESP_LOGE(TAG, "allocation failed. Biggest block in heap: %zu Bytes", this->allocator_.get_max_free_block_size());
     this->end_connection_();
+    this->download_failed_ = true;
     return false;
   }
   return true;
@@ -94,13 +95,13 @@ void OnlineImage::update() {
   } else {
     ESP_LOGI(TAG, "Updating image");
   }
+  this->download_failed_ = false;
 
   this->downloader_ = this->parent_->get(this->url_);
 
   if (this->downloader_ == nullptr) {
     ESP_LOGE(TAG, "Download failed.");
-    this->end_connection_();
-    this->download_error_callback_.call();
+    this->fail_download_();
     return;
   }
 
@@ -112,8 +113,7 @@ void OnlineImage::update() {
   }
   if (http_code != HTTP_CODE_OK) {
     ESP_LOGE(TAG, "HTTP result: %d", http_code);
-    this->end_connection_();
-    this->download_error_callback_.call();
+    this->fail_download_();
     return;
   }
 
@@ -128,14 +128,26 @@ void OnlineImage::update() {
 
   if (!this->decoder_) {
     ESP_LOGE(TAG, "Could not instantiate decoder. Image format unsupported.");
-    this->end_connection_();
-    this->download_error_callback_.call();
+    this->fail_download_();
     return;
   }
   this->decoder_->prepare(total_size);
+  if (this->progressive_) {
+    // Show the placeholder until the first rows of the new image are decoded.
+    this->data_start_ = nullptr;
+    this->height_ = 0;
+  }
   ESP_LOGI(TAG, "Downloading image");
 }
 
+float OnlineImage::get_progress() const {
+  if (this->download_failed_)
+    return 0.0f;
+  if (this->decoder_)
+    return this->decoder_->get_progress();
+  return this->data_start_ != nullptr ? 1.0f : 0.0f;
+}
+
 void OnlineImage::loop() {
   if (!this->decoder_) {
     // Not decoding at the moment => nothing to do.
@@ -162,8 +174,7 @@ void OnlineImage::loop() {
       auto fed = this->decoder_->decode(this->download_buffer_.data(), this->download_buffer_.unread());
       if (fed < 0) {
         ESP_LOGE(TAG, "Error when decoding image.");
-        this->end_connection_();
-        this->download_error_callback_.call();
+        this->fail_download_();
         return;
       }
       this->download_buffer_.read(fed);
@@ -240,6 +251,14 @@ void OnlineImage::draw_pixel_(int x, int y, Color color) {
   }
 }
 
+void OnlineImage::set_decoded_rows_(int rows) {
+  if (!this->progressive_ || rows <= this->height_)
+    return;
+  this->data_start_ = this->buffer_;
+  this->width_ = this->buffer_width_;
+  this->height_ = rows;
+}
+
 void OnlineImage::end_connection_() {
   if (this->downloader_) {
     this->downloader_->end();
@@ -249,6 +268,12 @@ void OnlineImage::end_connection_() {
   this->download_buffer_.reset();
 }
 
+void OnlineImage::fail_download_() {
+  this->end_connection_();
+  this->download_failed_ = true;
+  this->download_error_callback_.call();
+}
+
 bool OnlineImage::validate_url_(const std::string &url) {
   if ((url.length() < 8) || (url.find("http") != 0) || (url.find("://") == std::string::npos)) {
     ESP_LOGE(TAG, "URL is invalid and/or must be prefixed with 'http://' or 'https://'");
@@ -70,6 +70,29 @@ class OnlineImage : public PollingComponent,
    */
   void set_placeholder(image::Image *placeholder) { this->placeholder_ = placeholder; }
 
+  /**
+   * @brief Show the image while it is being decoded.
+   *
+   * The rows decoded so far are drawn as soon as they are available, instead of
+   * the placeholder (or the previous image) being shown until the download completes.
+   */
+  void set_progressive(bool progressive) { this->progressive_ = progressive; }
+
+  /**
+   * @brief Progress of the current download.
+   *
+   * @return The fraction of the image that has been downloaded and decoded (0 to 1),
+   *  or 1 if no download is running and an image is available. 0 after a failed download.
+   */
+  float get_progress() const;
+
+  /**
+   * @brief Whether the last download failed.
+   *
+   * The image keeps showing the previous image, or in progressive mode the rows decoded before the failure.
+   */
+  bool is_download_failed() const { return this->download_failed_; }
+
   /**
    * Release the buffer storing the image. The image will need to be downloaded again
    * to be able to be displayed.
@@ -107,7 +130,18 @@ class OnlineImage : public PollingComponent,
    */
   void draw_pixel_(int x, int y, Color color);
 
+  /**
+   * @brief Record that the decoder has reached the given row.
+   *
+   * In progressive mode, this makes the rows decoded so far drawable.
+   *
+   * @param rows Number of rows, from the top, that contain decoded pixels.
+   */
+  void set_decoded_rows_(int rows);
+
   void end_connection_();
+  /// End the connection, remember the failure and notify the error callbacks.
+  void fail_download_();
 
   CallbackManager<void()> download_finished_callback_{};
   CallbackManager<void()> download_error_callback_{};
@@ -120,6 +154,8 @@ class OnlineImage : public PollingComponent,
 
   const ImageFormat format_;
   image::Image *placeholder_{nullptr};
+  bool progressive_{false};
+  bool download_failed_{false};
 
   std::string url_{""};
 
@@ -0,0 +1,340 @@
+#include "preference_log.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+
+namespace esphome {
+namespace preferences {
+
+static const char *const TAG = "preferences.log";
+
+uint16_t PreferenceLog::record_crc_(uint32_t key, const uint8_t *data, uint16_t len) {
+  uint8_t header[6];
+  memcpy(header, &key, sizeof(key));
+  memcpy(header + 4, &len, sizeof(len));
+  uint16_t crc = crc16(header, sizeof(header));
+  return crc16(data, len, crc);
+}
+
+PreferenceLog::Entry *PreferenceLog::find_(uint32_t key) {
+  for (auto &entry : this->entries_) {
+    if (entry.key == key)
+      return &entry;
+  }
+  return nullptr;
+}
+
+size_t PreferenceLog::get_live_bytes() const {
+  size_t total = 0;
+  for (const auto &entry : this->entries_)
+    total += record_size_(entry.length);
+  return total;
+}
+
+size_t PreferenceLog::free_sector_count_() const {
+  return std::count(this->sequence_.begin(), this->sequence_.end(), ERASED_WORD);
+}
+
+bool PreferenceLog::open() {
+  const size_t count = this->flash_->get_sector_count();
+  const size_t size = this->flash_->get_sector_size();
+  this->entries_.clear();
+  this->sequence_.assign(count, ERASED_WORD);
+  this->dirty_.assign(count, false);
+  this->has_head_ = false;
+  if (count < 3 || size <= SECTOR_HEADER_SIZE + RECORD_HEADER_SIZE || size % 4 != 0) {
+    ESP_LOGE(TAG, "Unsupported flash geometry: %zu sectors of %zu bytes", count, size);
+    return false;
+  }
+
+  std::vector<size_t> order;
+  uint32_t words[8];
+  for (size_t sector = 0; sector < count; sector++) {
+    const size_t base = sector * size;
+    if (!this->flash_->read(base, reinterpret_cast<uint8_t *>(words), SECTOR_HEADER_SIZE))
+      return false;
+    if (words[0] == SECTOR_MAGIC && words[1] != ERASED_WORD) {
+      this->sequence_[sector] = words[1];
+      order.push_back(sector);
+      continue;
+    }
+    // A sector is only reused without an erase if it is completely blank.
+    for (size_t offset = 0; offset < size && !this->dirty_[sector]; offset += sizeof(words)) {
+      const size_t chunk = std::min(sizeof(words), size - offset);
+      if (!this->flash_->read(base + offset, reinterpret_cast<uint8_t *>(words), chunk))
+        return false;
+      for (size_t i = 0; i < chunk / 4; i++) {
+        if (words[i] != ERASED_WORD)
+          this->dirty_[sector] = true;
+      }
+    }
+  }
+
+  std::sort(order.begin(), order.end(),
+            [this](size_t a, size_t b) { return this->sequence_[a] < this->sequence_[b]; });
+  bool head_torn = false;
+  for (size_t sector : order) {
+    size_t end;
+    head_torn = !this->scan_sector_(sector, &end);
+    this->head_ = sector;
+    this->head_offset_ = end;
+    this->has_head_ = true;
+  }
+
+  // Only a compaction into the spare sector takes the last free sector. If it was interrupted before all records
+  // were copied, the head holds nothing but copies of the still intact oldest sector, so it can be dropped.
+  if (this->has_head_ && head_torn && this->free_sector_count_() == 0) {
+    ESP_LOGW(TAG, "Discarding interrupted compaction in sector %zu", this->head_);
+    if (!this->flash_->erase_sector(this->head_))
+      return false;
+    return this->open();
+  }
+
+  // A power loss while reclaiming the oldest sector leaves the spare sector in use; finish the compaction now.
+  if (this->has_head_ && this->free_sector_count_() < 2) {
+    ESP_LOGW(TAG, "Resuming interrupted compaction");
+    // On failure every record is still readable, only writes will keep failing.
+    if (!this->reclaim_())
+      ESP_LOGE(TAG, "Could not reclaim a sector");
+  }
+  ESP_LOGD(TAG, "Loaded %zu records (%zu/%zu bytes) from %zu sectors", this->entries_.size(), this->get_live_bytes(),
+           this->get_capacity(), order.size());
+  return true;
+}
+
+bool PreferenceLog::scan_sector_(size_t sector, size_t *end) {
+  const size_t size = this->flash_->get_sector_size();
+  const size_t base = sector * size;
+  size_t offset = SECTOR_HEADER_SIZE;
+  std::vector<uint8_t> payload;
+  while (offset + RECORD_HEADER_SIZE <= size) {
+    uint32_t header[2];
+    if (!this->flash_->read(base + offset, reinterpret_cast<uint8_t *>(header), sizeof(header)))
+      break;
+    if (header[0] == ERASED_WORD && header[1] == ERASED_WORD) {
+      *end = offset;
+      return true;
+    }
+    const uint32_t key = header[0];
+    const uint16_t len = header[1] & 0xFFFF;
+    const uint16_t crc = header[1] >> 16;
+    if (key == ERASED_WORD || offset + record_size_(len) > size)
+      break;
+    payload.resize(len);
+    if (!this->flash_->read(base + offset + RECORD_HEADER_SIZE, payload.data(), len))
+      break;
+    if (record_crc_(key, payload.data(), len) != crc)
+      break;
+
+    Entry *entry = this->find_(key);
+    if (entry == nullptr) {
+      this->entries_.push_back(Entry{});
+      entry = &this->entries_.back();
+      entry->key = key;
+    }
+    entry->offset = base + offset;
+    entry->sector = sector;
+    entry->length = len;
+    entry->crc = crc;
+    offset += record_size_(len);
+  }
+  if (offset + RECORD_HEADER_SIZE > size) {
+    *end = size;
+    return true;
+  }
+  // Never append behind a torn record, the remainder of the sector is not known to be erased.
+  ESP_LOGW(TAG, "Torn record in sector %zu at offset %zu", sector, offset);
+  *end = size;
+  return false;
+}
+
+bool PreferenceLog::start_sector_(size_t sector) {
+  const size_t size = this->flash_->get_sector_size();
+  if (this->dirty_[sector]) {
+    if (!this->flash_->erase_sector(sector))
+      return false;
+    this->dirty_[sector] = false;
+  }
+  uint32_t sequence = 0;
+  for (uint32_t seq : this->sequence_) {
+    if (seq != ERASED_WORD)
+      sequence = std::max(sequence, seq);
+  }
+  const uint32_t header[2] = {SECTOR_MAGIC, sequence + 1};
+  if (!this->flash_->write(sector * size, reinterpret_cast<const uint8_t *>(header), sizeof(header))) {
+    this->dirty_[sector] = true;
+    return false;
+  }
+  this->sequence_[sector] = sequence + 1;
+  this->head_ = sector;
+  this->head_offset_ = SECTOR_HEADER_SIZE;
+  this->has_head_ = true;
+  return true;
+}
+
+bool PreferenceLog::append_(uint32_t key, const uint8_t *data, uint16_t len, uint16_t crc) {
+  const size_t size = this->flash_->get_sector_size();
+  std::vector<uint8_t> record(record_size_(len), 0xFF);
+  const uint32_t header[2] = {key, uint32_t(len) | (uint32_t(crc) << 16)};
+  memcpy(record.data(), header, sizeof(header));
+  memcpy(record.data() + RECORD_HEADER_SIZE, data, len);
+
+  const size_t address = this->head_ * size + this->head_offset_;
+  // Even a failed write may have consumed the space, so move past it either way.
+  this->head_offset_ += record.size();
+  if (!this->flash_->write(address, record.data(), record.size()))
+    return false;
+  this->records_written_++;
+
+  Entry *entry = this->find_(key);
+  if (entry == nullptr) {
+    this->entries_.push_back(Entry{});
+    entry = &this->entries_.back();
+    entry->key = key;
+  }
+  entry->offset = address;
+  entry->sector = this->head_;
+  entry->length = len;
+  entry->crc = crc;
+  return true;
+}
+
+size_t PreferenceLog::find_free_sector_() const {
+  const size_t count = this->sequence_.size();
+  const size_t first = this->has_head_ ? this->head_ + 1 : 0;
+  for (size_t i = 0; i < count; i++) {
+    const size_t sector = (first + i) % count;
+    if (this->sequence_[sector] == ERASED_WORD)
+      return sector;
+  }
+  return count;
+}
+
+bool PreferenceLog::advance_() {
+  const size_t next = this->find_free_sector_();
+  if (next == this->sequence_.size()) {
+    ESP_LOGE(TAG, "No free sector available");
+    return false;
+  }
+  return this->start_sector_(next);
+}
+
+bool PreferenceLog::reclaim_() {
+  const size_t count = this->sequence_.size();
+  while (this->free_sector_count_() < 2) {
+    size_t oldest = count;
+    for (size_t sector = 0; sector < count; sector++) {
+      if (sector == this->head_ || this->sequence_[sector] == ERASED_WORD)
+        continue;
+      if (oldest == count || this->sequence_[sector] < this->sequence_[oldest])
+        oldest = sector;
+    }
+    if (oldest == count || !this->compact_(oldest))
+      return false;
+  }
+  return true;
+}
+
+bool PreferenceLog::compact_(size_t sector) {
+  const size_t size = this->flash_->get_sector_size();
+
+  // Copy the entries, append_() may reallocate entries_.
+  std::vector<Entry> live;
+  size_t needed = 0;
+  for (const auto &entry : this->entries_) {
+    if (entry.sector == sector) {
+      live.push_back(entry);
+      needed += record_size_(entry.length);
+    }
+  }
+  ESP_LOGV(TAG, "Compacting sector %zu: %zu live records", sector, live.size());
+
+  if (this->head_offset_ + needed > size) {
+    // The head has no room left (e.g. it ends in a torn record), continue in the spare sector.
+    ESP_LOGW(TAG, "Compacting sector %zu into a new sector", sector);
+    if (!this->advance_())
+      return false;
+    if (this->head_offset_ + needed > size)
+      return false;
+  }
+  this->compactions_++;
+
+  // The sector is only erased once all its records have been copied, so a power loss never loses a value.
+  std::vector<uint8_t> payload;
+  for (const auto &entry : live) {
+    payload.resize(entry.length);
+    if (!this->flash_->read(entry.offset + RECORD_HEADER_SIZE, payload.data(), entry.length) ||
+        !this->append_(entry.key, payload.data(), entry.length, entry.crc))
+      return false;
+  }
+  if (!this->flash_->erase_sector(sector))
+    return false;
+  this->sequence_[sector] = ERASED_WORD;
+  this->dirty_[sector] = false;
+  return true;
+}
+
+bool PreferenceLog::format() {
+  for (size_t sector = 0; sector < this->sequence_.size(); sector++) {
+    if (!this->flash_->erase_sector(sector))
+      return false;
+    this->sequence_[sector] = ERASED_WORD;
+    this->dirty_[sector] = false;
+  }
+  this->entries_.clear();
+  this->has_head_ = false;
+  return true;
+}
+
+bool PreferenceLog::load(uint32_t key, uint8_t *data, size_t len) {
+  const Entry *entry = this->find_(key);
+  if (entry == nullptr || entry->length != len)
+    return false;
+  if (!this->flash_->read(entry->offset + RECORD_HEADER_SIZE, data, len))
+    return false;
+  return record_crc_(key, data, len) == entry->crc;
+}
+
+bool PreferenceLog::write(uint32_t key, const uint8_t *data, size_t len) {
+  if (key == ERASED_WORD || len > 0xFFFF)
+    return false;
+  const uint16_t crc = record_crc_(key, data, len);
+  const size_t size = this->flash_->get_sector_size();
+
+  Entry *entry = this->find_(key);
+  size_t live = this->get_live_bytes() + record_size_(len);
+  if (entry != nullptr) {
+    if (entry->length == len && entry->crc == crc) {
+      std::vector<uint8_t> stored(len);
+      if (this->flash_->read(entry->offset + RECORD_HEADER_SIZE, stored.data(), len) &&
+          (len == 0 || memcmp(stored.data(), data, len) == 0)) {
+        this->records_unchanged_++;
+        return true;
+      }
+    }
+    live -= record_size_(entry->length);
+  }
+  if (live > this->get_capacity()) {
+    ESP_LOGE(TAG, "Not enough space for key 0x%08" PRIX32 " (%zu bytes, %zu/%zu in use)", key, len,
+             this->get_live_bytes(), this->get_capacity());
+    return false;
+  }
+
+  if (!this->has_head_ || this->head_offset_ + record_size_(len) > size) {
+    if (!this->advance_())
+      return false;
+    if (this->head_offset_ + record_size_(len) > size)
+      return false;
+  }
+  // Append before reclaiming: the previous record of this key stays valid until the new one is written, and the
+  // reclaimed sector does not have to carry it forward.
+  if (!this->append_(key, data, len, crc))
+    return false;
+  return this->reclaim_();
+}
+
+}  // namespace preferences
+}  // namespace esphome
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace esphome {
+namespace preferences {
+
+/// Sector based storage with NOR flash semantics: writes may only clear bits and a sector has to be erased
+/// (set to 0xFF) before it can be written again.
+class PreferenceFlash {
+ public:
+  virtual size_t get_sector_size() const = 0;
+  virtual size_t get_sector_count() const = 0;
+  virtual bool read(size_t address, uint8_t *data, size_t len) = 0;
+  virtual bool write(size_t address, const uint8_t *data, size_t len) = 0;
+  virtual bool erase_sector(size_t sector) = 0;
+};
+
+/** Append-only, wear-levelled preference store on top of a PreferenceFlash.
+ *
+ * Every sector starts with a header (magic, sequence number) followed by records of
+ * (key, length, CRC-16, payload) padded to 4 bytes. Writing a key appends a new record to the head sector,
+ * records whose payload did not change are skipped. Sectors are used round-robin and one spare sector is kept:
+ * once fewer than two sectors are free, the live records of the oldest sector are copied forward and that sector
+ * is erased. A sector is only erased after its records were copied, to the spare sector if the head is full.
+ *
+ * A torn record (CRC mismatch) ends the scan of its sector and the sector is not written again until it is
+ * erased, so an interrupted write never corrupts older values. All live records have to fit into one sector and
+ * at least three sectors are needed.
+ */
+class PreferenceLog {
+ public:
+  explicit PreferenceLog(PreferenceFlash *flash) : flash_(flash) {}
+
+  /// Scan the flash and rebuild the in-memory index. Must be called before any other method.
+  bool open();
+  /// Erase all sectors, dropping every stored record.
+  bool format();
+
+  bool load(uint32_t key, uint8_t *data, size_t len);
+  /// Append a record for \p key, unless the stored value is identical.
+  bool write(uint32_t key, const uint8_t *data, size_t len);
+
+  /// Bytes occupied by the latest record of every key (headers included).
+  size_t get_live_bytes() const;
+  /// Maximum value of get_live_bytes(), i.e. the usable size of one sector.
+  size_t get_capacity() const { return this->flash_->get_sector_size() - SECTOR_HEADER_SIZE; }
+  size_t get_entry_count() const { return this->entries_.size(); }
+  uint32_t get_records_written() const { return this->records_written_; }
+  uint32_t get_records_unchanged() const { return this->records_unchanged_; }
+  uint32_t get_compactions() const { return this->compactions_; }
+
+ protected:
+  static constexpr uint32_t SECTOR_MAGIC = 0x45535052;  // "ESPR"
+  static constexpr uint32_t ERASED_WORD = 0xFFFFFFFF;
+  static constexpr size_t SECTOR_HEADER_SIZE = 8;
+  static constexpr size_t RECORD_HEADER_SIZE = 8;
+
+  struct Entry {
+    uint32_t key;
+    uint32_t offset;  ///< Absolute address of the record header.
+    uint16_t sector;
+    uint16_t length;
+    uint16_t crc;
+  };
+
+  static size_t record_size_(size_t len) { return RECORD_HEADER_SIZE + ((len + 3) & ~size_t(3)); }
+  static uint16_t record_crc_(uint32_t key, const uint8_t *data, uint16_t len);
+
+  Entry *find_(uint32_t key);
+  bool scan_sector_(size_t sector, size_t *end);
+  bool start_sector_(size_t sector);
+  bool append_(uint32_t key, const uint8_t *data, uint16_t len, uint16_t crc);
+  /// Move the head to the next free sector.
+  bool advance_();
+  /// Compact the oldest sectors until two sectors are free.
+  bool reclaim_();
+  /// Copy the live records of \p sector to the head (or a new head if they do not fit) and erase it.
+  bool compact_(size_t sector);
+  /// The next free sector after the head, the sector count if there is none.
+  size_t find_free_sector_() const;
+  size_t free_sector_count_() const;
+
+  PreferenceFlash *flash_;
+  std::vector<Entry> entries_;
+  /// Sequence number per sector, ERASED_WORD for an erased sector.
+  std::vector<uint32_t> sequence_;
+  /// Sectors that contain garbage (e.g. an interrupted header write) and need an erase before use.
+  std::vector<bool> dirty_;
+  size_t head_{0};
+  size_t head_offset_{0};
+  bool has_head_{false};
+  uint32_t records_written_{0};
+  uint32_t records_unchanged_{0};
+  uint32_t compactions_{0};
+};
+
+}  // namespace preferences
+}  // namespace esphome
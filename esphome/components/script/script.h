@@ -99,7 +99,7 @@ template<typename... Ts> class QueueingScript : public Script<Ts...>, public Com
 
       this->esp_logd_(__LINE__, "Script '%s' queueing new instance (mode: queued)", this->name_.c_str());
       this->num_runs_++;
-      this->var_queue_.push(std::make_tuple(x...));
+      this->var_queue_.emplace(x...);
       return;
     }
 
@@ -116,7 +116,8 @@ template<typename... Ts> class QueueingScript : public Script<Ts...>, public Com
   void loop() override {
     if (this->num_runs_ != 0 && !this->is_action_running()) {
       this->num_runs_--;
-      auto &vars = this->var_queue_.front();
+      // Move the arguments out, the reference would dangle after pop()
+      auto vars = std::move(this->var_queue_.front());
       this->var_queue_.pop();
       this->trigger_tuple_(vars, typename gens<sizeof...(Ts)>::type());
     }
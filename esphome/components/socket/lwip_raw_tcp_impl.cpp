@@ -485,6 +485,11 @@ class LWIPRawImpl : public Socket {
     return 0;
   }
 
+  bool ready() const override {
+    // Incoming data and connections are queued by the lwIP callbacks; a missing pcb means read() reports an error.
+    return this->pcb_ == nullptr || this->rx_closed_ || this->rx_buf_ != nullptr || !this->accepted_sockets_.empty();
+  }
+
   err_t accept_fn(struct tcp_pcb *newpcb, err_t err) {
     LWIP_LOG("accept(newpcb=%p err=%d)", newpcb, err);
     if (err != ERR_OK || newpcb == nullptr) {
@@ -606,6 +611,11 @@ std::unique_ptr<Socket> socket(int domain, int type, int protocol) {
   return std::unique_ptr<Socket>{sock};
 }
 
+// Raw TCP sockets are callback driven and always know whether they are ready.
+std::unique_ptr<Socket> socket_loop_monitored(int domain, int type, int protocol) {
+  return socket(domain, type, protocol);
+}
+
 }  // namespace socket
 }  // namespace esphome
 
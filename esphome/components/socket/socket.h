@@ -42,6 +42,13 @@ class Socket {
 
   virtual int setblocking(bool blocking) = 0;
   virtual int loop() { return 0; };
+
+  /** Check whether a read (or accept) would return something, without performing it.
+   *
+   * Sockets that are monitored by the main loop, or whose implementation buffers incoming data itself, know this
+   * without a system call. All other sockets always report being ready, so callers fall back to polling.
+   */
+  virtual bool ready() const { return true; }
 };
 
 /// Create a socket of the given domain, type and protocol.
@@ -50,6 +57,16 @@ std::unique_ptr<Socket> socket(int domain, int type, int protocol);
 /// Create a socket in the newest available IP domain (IPv6 or IPv4) of the given type and protocol.
 std::unique_ptr<Socket> socket_ip(int type, int protocol);
 
+/** Create a socket that is monitored by the main loop, see Socket::ready().
+ *
+ * The main loop wakes up as soon as the socket becomes readable. Sockets accepted from a monitored listening socket
+ * are monitored as well.
+ */
+std::unique_ptr<Socket> socket_loop_monitored(int domain, int type, int protocol);
+
+/// Create a socket monitored by the main loop in the newest available IP domain (IPv6 or IPv4).
+std::unique_ptr<Socket> socket_ip_loop_monitored(int type, int protocol);
+
 /// Set a sockaddr to the specified address and port for the IP version used by socket_ip().
 socklen_t set_sockaddr(struct sockaddr *addr, socklen_t addrlen, const std::string &ip_address, uint16_t port);
 
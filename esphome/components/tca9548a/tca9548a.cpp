@@ -6,7 +6,12 @@ namespace tca9548a {
 
 static const char *const TAG = "tca9548a";
 
-i2c::ErrorCode TCA9548AChannel::readv(uint8_t address, i2c::ReadBuffer *buffers, size_t cnt) {
+// The channel shares the lock of the parent bus. readv()/writev() hold it for the whole impl, so selecting the
+// channel, the transfer and deselecting it again are not interleaved with transfers on other channels.
+void TCA9548AChannel::enable_lock() { this->parent_->bus_->enable_lock(); }
+i2c::I2CMutex *TCA9548AChannel::get_lock() const { return this->parent_->bus_->get_lock(); }
+
+i2c::ErrorCode TCA9548AChannel::readv_impl(uint8_t address, i2c::ReadBuffer *buffers, size_t cnt) {
   auto err = this->parent_->switch_to_channel(channel_);
   if (err != i2c::ERROR_OK)
     return err;
@@ -14,7 +19,7 @@ i2c::ErrorCode TCA9548AChannel::readv(uint8_t address, i2c::ReadBuffer *buffers,
   this->parent_->disable_all_channels();
   return err;
 }
-i2c::ErrorCode TCA9548AChannel::writev(uint8_t address, i2c::WriteBuffer *buffers, size_t cnt, bool stop) {
+i2c::ErrorCode TCA9548AChannel::writev_impl(uint8_t address, i2c::WriteBuffer *buffers, size_t cnt, bool stop) {
   auto err = this->parent_->switch_to_channel(channel_);
   if (err != i2c::ERROR_OK)
     return err;
@@ -14,10 +14,13 @@ class TCA9548AChannel : public i2c::I2CBus {
   void set_channel(uint8_t channel) { channel_ = channel; }
   void set_parent(TCA9548AComponent *parent) { parent_ = parent; }
 
-  i2c::ErrorCode readv(uint8_t address, i2c::ReadBuffer *buffers, size_t cnt) override;
-  i2c::ErrorCode writev(uint8_t address, i2c::WriteBuffer *buffers, size_t cnt, bool stop) override;
+  void enable_lock() override;
+  i2c::I2CMutex *get_lock() const override;
 
  protected:
+  i2c::ErrorCode readv_impl(uint8_t address, i2c::ReadBuffer *buffers, size_t cnt) override;
+  i2c::ErrorCode writev_impl(uint8_t address, i2c::WriteBuffer *buffers, size_t cnt, bool stop) override;
+
   uint8_t channel_;
   TCA9548AComponent *parent_;
 };
@@ -9,6 +9,7 @@ static const char *const TAG = "tee501";
 void TEE501Component::setup() {
   ESP_LOGCONFIG(TAG, "Setting up TEE501...");
   uint8_t address[] = {0x70, 0x29};
+  i2c::I2CBusLock lock(this->bus_);
   this->write(address, 2, false);
   uint8_t identification[9];
   this->read(identification, 9);
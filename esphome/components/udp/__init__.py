@@ -34,6 +34,7 @@ CONF_UDP_ID = "udp_id"
 CONF_PING_PONG_ENABLE = "ping_pong_enable"
 CONF_PING_PONG_RECYCLE_TIME = "ping_pong_recycle_time"
 CONF_ROLLING_CODE_ENABLE = "rolling_code_enable"
+CONF_HASHED_IDS = "hashed_ids"
 
 
 def sensor_validation(cls: MockObjClass):
@@ -89,6 +90,7 @@ CONFIG_SCHEMA = cv.All(
             ),
             cv.Optional(CONF_ROLLING_CODE_ENABLE, default=False): cv.boolean,
             cv.Optional(CONF_PING_PONG_ENABLE, default=False): cv.boolean,
+            cv.Optional(CONF_HASHED_IDS, default=False): cv.boolean,
             cv.Optional(
                 CONF_PING_PONG_RECYCLE_TIME, default="600s"
             ): cv.positive_time_period_seconds,
@@ -130,6 +132,7 @@ async def to_code(config):
     cg.add(var.set_port(config[CONF_PORT]))
     cg.add(var.set_rolling_code_enable(config[CONF_ROLLING_CODE_ENABLE]))
     cg.add(var.set_ping_pong_enable(config[CONF_PING_PONG_ENABLE]))
+    cg.add(var.set_hashed_ids(config[CONF_HASHED_IDS]))
     cg.add(
         var.set_ping_pong_recycle_time(
             config[CONF_PING_PONG_RECYCLE_TIME].total_seconds
@@ -34,6 +34,15 @@ namespace udp {
  *      bool value: 1 bytes
  *      name length: 1 byte
  *      name
+ * With hashed ids, instead of the above:
+ * repeat:
+ *      SENSOR_HASH_KEY: 1 byte
+ *      fnv1_hash(name): 4 bytes
+ *      float value: 4 bytes
+ * repeat:
+ *      BINARY_SENSOR_HASH_KEY: 1 byte
+ *      fnv1_hash(name): 4 bytes
+ *      bool value: 1 byte
  *
  * Padded to a 4 byte boundary with nulls
  *
@@ -112,6 +121,8 @@ enum DataKey {
   BINARY_SENSOR_KEY,
   PING_KEY,
   ROLLING_CODE_KEY,
+  SENSOR_HASH_KEY,
+  BINARY_SENSOR_HASH_KEY,
 };
 
 static const size_t MAX_PING_KEYS = 4;
@@ -224,7 +235,7 @@ void UDPComponent::setup() {
   // create listening socket if we either want to subscribe to providers, or need to listen
   // for ping key broadcasts.
   if (this->should_listen_) {
-    this->listen_socket_ = socket::socket(AF_INET, SOCK_DGRAM, IPPROTO_IP);
+    this->listen_socket_ = socket::socket_loop_monitored(AF_INET, SOCK_DGRAM, IPPROTO_IP);
     if (this->listen_socket_ == nullptr) {
       this->mark_failed();
       this->status_set_error("Could not create socket");
@@ -330,6 +341,24 @@ void UDPComponent::add_data_(uint8_t key, const char *id, uint32_t data) {
   add(this->data_, data);
   add(this->data_, id);
 }
+void UDPComponent::add_hashed_data_(uint8_t key, uint32_t id_hash, uint32_t data) {
+  if (1 + 4 + 4 + this->header_.size() + this->data_.size() > MAX_PACKET_SIZE) {
+    this->flush_();
+  }
+  add(this->data_, key);
+  add(this->data_, id_hash);
+  add(this->data_, data);
+}
+
+void UDPComponent::add_hashed_binary_data_(uint8_t key, uint32_t id_hash, bool data) {
+  if (1 + 4 + 1 + this->header_.size() + this->data_.size() > MAX_PACKET_SIZE) {
+    this->flush_();
+  }
+  add(this->data_, key);
+  add(this->data_, id_hash);
+  add(this->data_, (uint8_t) data);
+}
+
 void UDPComponent::send_data_(bool all) {
   if (!this->should_send_ || !network::is_connected())
     return;
@@ -338,7 +367,15 @@ void UDPComponent::send_data_(bool all) {
   for (auto &sensor : this->sensors_) {
     if (all || sensor.updated) {
       sensor.updated = false;
-      this->add_data_(SENSOR_KEY, sensor.id, sensor.sensor->get_state());
+      if (!this->hashed_ids_) {
+        this->add_data_(SENSOR_KEY, sensor.id, sensor.sensor->get_state());
+        continue;
+      }
+      FuData udata{.f32 = sensor.sensor->get_state()};
+      if (!all && udata.u32 == sensor.sent_bits)
+        continue;
+      sensor.sent_bits = udata.u32;
+      this->add_hashed_data_(SENSOR_HASH_KEY, sensor.id_hash, udata.u32);
     }
   }
 #endif
@@ -346,7 +383,11 @@ void UDPComponent::send_data_(bool all) {
   for (auto &sensor : this->binary_sensors_) {
     if (all || sensor.updated) {
       sensor.updated = false;
-      this->add_binary_data_(BINARY_SENSOR_KEY, sensor.id, sensor.sensor->state);
+      if (this->hashed_ids_) {
+        this->add_hashed_binary_data_(BINARY_SENSOR_HASH_KEY, sensor.id_hash, sensor.sensor->state);
+      } else {
+        this->add_binary_data_(BINARY_SENSOR_KEY, sensor.id, sensor.sensor->state);
+      }
     }
   }
 #endif
@@ -370,6 +411,8 @@ void UDPComponent::loop() {
   if (this->should_listen_) {
     for (;;) {
 #if defined(USE_SOCKET_IMPL_BSD_SOCKETS) || defined(USE_SOCKET_IMPL_LWIP_SOCKETS)
+      if (!this->listen_socket_->ready())
+        break;
       auto len = this->listen_socket_->read(buf, sizeof(buf));
 #endif
 #ifdef USE_SOCKET_IMPL_LWIP_TCP
@@ -525,6 +568,32 @@ void UDPComponent::process_(uint8_t *buf, const size_t len) {
       this->resend_ping_key_ = true;
       break;
     }
+    if (byte == SENSOR_HASH_KEY || byte == BINARY_SENSOR_HASH_KEY) {
+      const bool is_sensor = byte == SENSOR_HASH_KEY;
+      if (end - buf < (is_sensor ? 8 : 5)) {
+        ESP_LOGV(TAG, "Hashed sensor key requires at least %d more bytes", is_sensor ? 8 : 5);
+        return;
+      }
+      const uint32_t id_hash = get_uint32(buf);
+      rdata.u32 = is_sensor ? get_uint32(buf) : *buf++;
+      ESP_LOGV(TAG, "Found sensor key %d, id hash %08X, data %lX", byte, (unsigned) id_hash, (unsigned long) rdata.u32);
+      const uint64_t key = (uint64_t(provider.name_hash) << 32) | id_hash;
+#ifdef USE_SENSOR
+      if (is_sensor) {
+        auto it = this->remote_sensor_hashes_.find(key);
+        if (it != this->remote_sensor_hashes_.end())
+          it->second->publish_state(rdata.f32);
+      }
+#endif
+#ifdef USE_BINARY_SENSOR
+      if (!is_sensor) {
+        auto it = this->remote_binary_sensor_hashes_.find(key);
+        if (it != this->remote_binary_sensor_hashes_.end())
+          it->second->publish_state(rdata.u32 != 0);
+      }
+#endif
+      continue;
+    }
     if (byte == BINARY_SENSOR_KEY) {
       if (end - buf < 3) {
         ESP_LOGV(TAG, "Binary sensor key requires at least 3 more bytes");
@@ -567,6 +636,7 @@ void UDPComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "  Port: %u", this->port_);
   ESP_LOGCONFIG(TAG, "  Encrypted: %s", YESNO(this->is_encrypted_()));
   ESP_LOGCONFIG(TAG, "  Ping-pong: %s", YESNO(this->ping_pong_enable_));
+  ESP_LOGCONFIG(TAG, "  Hashed IDs: %s", YESNO(this->hashed_ids_));
   for (const auto &address : this->addresses_)
     ESP_LOGCONFIG(TAG, "  Address: %s", address.c_str());
 #ifdef USE_SENSOR
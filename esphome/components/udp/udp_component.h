@@ -1,6 +1,9 @@
 #pragma once
 
 #include "esphome/core/component.h"
+#include "esphome/core/defines.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/preferences.h"
 #ifdef USE_SENSOR
 #include "esphome/components/sensor/sensor.h"
 #endif
@@ -15,6 +18,7 @@
 #endif
 #include <vector>
 #include <map>
+#include <unordered_map>
 
 namespace esphome {
 namespace udp {
@@ -22,6 +26,7 @@ namespace udp {
 struct Provider {
   std::vector<uint8_t> encryption_key;
   const char *name;
+  uint32_t name_hash;
   uint32_t last_code[2];
 };
 
@@ -30,6 +35,9 @@ struct Sensor {
   sensor::Sensor *sensor;
   const char *id;
   bool updated;
+  uint32_t id_hash;
+  /// Bits of the last value sent with a hashed id, unchanged values are only sent on update().
+  uint32_t sent_bits;
 };
 #endif
 #ifdef USE_BINARY_SENSOR
@@ -37,6 +45,7 @@ struct BinarySensor {
   binary_sensor::BinarySensor *sensor;
   const char *id;
   bool updated;
+  uint32_t id_hash;
 };
 #endif
 
@@ -49,23 +58,25 @@ class UDPComponent : public PollingComponent {
 
 #ifdef USE_SENSOR
   void add_sensor(const char *id, sensor::Sensor *sensor) {
-    Sensor st{sensor, id, true};
+    Sensor st{sensor, id, true, fnv1_hash(id), 0};
     this->sensors_.push_back(st);
   }
   void add_remote_sensor(const char *hostname, const char *remote_id, sensor::Sensor *sensor) {
     this->add_provider(hostname);
     this->remote_sensors_[hostname][remote_id] = sensor;
+    this->remote_sensor_hashes_[this->remote_key_(hostname, remote_id)] = sensor;
   }
 #endif
 #ifdef USE_BINARY_SENSOR
   void add_binary_sensor(const char *id, binary_sensor::BinarySensor *sensor) {
-    BinarySensor st{sensor, id, true};
+    BinarySensor st{sensor, id, true, fnv1_hash(id)};
     this->binary_sensors_.push_back(st);
   }
 
   void add_remote_binary_sensor(const char *hostname, const char *remote_id, binary_sensor::BinarySensor *sensor) {
     this->add_provider(hostname);
     this->remote_binary_sensors_[hostname][remote_id] = sensor;
+    this->remote_binary_sensor_hashes_[this->remote_key_(hostname, remote_id)] = sensor;
   }
 #endif
   void add_address(const char *addr) { this->addresses_.emplace_back(addr); }
@@ -79,6 +90,7 @@ class UDPComponent : public PollingComponent {
       provider.last_code[0] = 0;
       provider.last_code[1] = 0;
       provider.name = hostname;
+      provider.name_hash = fnv1_hash(hostname);
       this->providers_[hostname] = provider;
 #ifdef USE_SENSOR
       this->remote_sensors_[hostname] = std::map<std::string, sensor::Sensor *>();
@@ -93,6 +105,8 @@ class UDPComponent : public PollingComponent {
   void set_rolling_code_enable(bool enable) { this->rolling_code_enable_ = enable; }
   void set_ping_pong_enable(bool enable) { this->ping_pong_enable_ = enable; }
   void set_ping_pong_recycle_time(uint32_t recycle_time) { this->ping_pong_recyle_time_ = recycle_time; }
+  /// Send sensors as a 32-bit hash of their id instead of the id string, and send sensor values only when changed.
+  void set_hashed_ids(bool hashed_ids) { this->hashed_ids_ = hashed_ids; }
   void set_provider_encryption(const char *name, std::vector<uint8_t> key) {
     this->providers_[name].encryption_key = std::move(key);
   }
@@ -105,6 +119,12 @@ class UDPComponent : public PollingComponent {
   void add_data_(uint8_t key, const char *id, uint32_t data);
   void increment_code_();
   void add_binary_data_(uint8_t key, const char *id, bool data);
+  void add_hashed_data_(uint8_t key, uint32_t id_hash, uint32_t data);
+  void add_hashed_binary_data_(uint8_t key, uint32_t id_hash, bool data);
+  /// Key of a remote sensor in the hashed id lookup tables.
+  uint64_t remote_key_(const char *hostname, const char *remote_id) {
+    return (uint64_t(this->providers_[hostname].name_hash) << 32) | fnv1_hash(remote_id);
+  }
   void init_data_();
 
   bool updated_{};
@@ -113,6 +133,7 @@ class UDPComponent : public PollingComponent {
   uint32_t rolling_code_[2]{};
   bool rolling_code_enable_{};
   bool ping_pong_enable_{};
+  bool hashed_ids_{};
   uint32_t ping_pong_recyle_time_{};
   uint32_t last_key_time_{};
   bool resend_ping_key_{};
@@ -137,10 +158,12 @@ class UDPComponent : public PollingComponent {
 #ifdef USE_SENSOR
   std::vector<Sensor> sensors_{};
   std::map<std::string, std::map<std::string, sensor::Sensor *>> remote_sensors_{};
+  std::unordered_map<uint64_t, sensor::Sensor *> remote_sensor_hashes_{};
 #endif
 #ifdef USE_BINARY_SENSOR
   std::vector<BinarySensor> binary_sensors_{};
   std::map<std::string, std::map<std::string, binary_sensor::BinarySensor *>> remote_binary_sensors_{};
+  std::unordered_map<uint64_t, binary_sensor::BinarySensor *> remote_binary_sensor_hashes_{};
 #endif
 
   std::map<std::string, Provider> providers_{};
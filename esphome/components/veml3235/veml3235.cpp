@@ -17,6 +17,7 @@ void VEML3235Sensor::setup() {
     this->mark_failed();
     return;
   }
+  i2c::I2CBusLock lock(this->bus_);
   if ((this->write(&ID_REG, 1, false) != i2c::ERROR_OK) || !this->read_bytes_raw(device_id, 2)) {
     ESP_LOGE(TAG, "Unable to read ID");
     this->mark_failed();
@@ -52,6 +53,7 @@ float VEML3235Sensor::read_lx_() {
   }
 
   uint8_t als_regs[] = {0, 0};
+  i2c::I2CBusLock lock(this->bus_);
   if ((this->write(&ALS_REG, 1, false) != i2c::ERROR_OK) || !this->read_bytes_raw(als_regs, 2)) {
     this->status_set_warning();
     return NAN;
@@ -17,9 +17,11 @@ static const char *const TAG = "voice_assistant";
 #endif
 
 static const size_t SAMPLE_RATE_HZ = 16000;
-static const size_t INPUT_BUFFER_SIZE = 32 * SAMPLE_RATE_HZ / 1000;  // 32ms * 16kHz / 1000ms
+static const size_t SEND_SAMPLES = 32 * SAMPLE_RATE_HZ / 1000;  // 32ms * 16kHz / 1000ms
 static const size_t BUFFER_SIZE = 512 * SAMPLE_RATE_HZ / 1000;
-static const size_t SEND_BUFFER_SIZE = INPUT_BUFFER_SIZE * sizeof(int16_t);
+#ifdef USE_ESP_ADF
+static const size_t VAD_FRAME_SAMPLES = VAD_FRAME_LENGTH_MS * SAMPLE_RATE_HZ / 1000;
+#endif
 static const size_t RECEIVE_SIZE = 1024;
 static const size_t SPEAKER_BUFFER_SIZE = 16 * RECEIVE_SIZE;
 
@@ -28,6 +30,8 @@ VoiceAssistant::VoiceAssistant() { global_voice_assistant = this; }
 float VoiceAssistant::get_setup_priority() const { return setup_priority::AFTER_CONNECTION; }
 
 bool VoiceAssistant::start_udp_socket_() {
+  // Not watched by the main loop: the socket is only read while streaming the response, so datagrams arriving in
+  // any other state would wake the loop over and over.
   this->socket_ = socket::socket(AF_INET, SOCK_DGRAM, IPPROTO_IP);
   if (this->socket_ == nullptr) {
     ESP_LOGE(TAG, "Could not create socket");
@@ -71,7 +75,7 @@ bool VoiceAssistant::start_udp_socket_() {
 }
 
 bool VoiceAssistant::allocate_buffers_() {
-  if (this->send_buffer_ != nullptr) {
+  if (this->reader_ != nullptr) {
     return true;  // Already allocated
   }
 
@@ -86,45 +90,34 @@ bool VoiceAssistant::allocate_buffers_() {
   }
 #endif
 
+#ifdef USE_ESP_ADF
   ExternalRAMAllocator<int16_t> allocator(ExternalRAMAllocator<int16_t>::ALLOW_FAILURE);
-  this->input_buffer_ = allocator.allocate(INPUT_BUFFER_SIZE);
-  if (this->input_buffer_ == nullptr) {
-    ESP_LOGW(TAG, "Could not allocate input buffer");
+  this->vad_buffer_ = allocator.allocate(VAD_FRAME_SAMPLES);
+  if (this->vad_buffer_ == nullptr) {
+    ESP_LOGW(TAG, "Could not allocate VAD buffer");
     return false;
   }
 
-#ifdef USE_ESP_ADF
   this->vad_instance_ = vad_create(VAD_MODE_4);
+  this->vad_reader_ = this->mic_->add_reader(VAD_FRAME_SAMPLES);
 #endif
 
-  this->ring_buffer_ = RingBuffer::create(BUFFER_SIZE * sizeof(int16_t));
-  if (this->ring_buffer_ == nullptr) {
-    ESP_LOGW(TAG, "Could not allocate ring buffer");
-    return false;
-  }
-
-  ExternalRAMAllocator<uint8_t> send_allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
-  this->send_buffer_ = send_allocator.allocate(SEND_BUFFER_SIZE);
-  if (send_buffer_ == nullptr) {
-    ESP_LOGW(TAG, "Could not allocate send buffer");
-    return false;
-  }
+  // Audio is buffered in the microphone's capture buffer until the pipeline is ready to receive it
+  this->reader_ = this->mic_->add_reader(BUFFER_SIZE);
 
   return true;
 }
 
 void VoiceAssistant::clear_buffers_() {
-  if (this->send_buffer_ != nullptr) {
-    memset(this->send_buffer_, 0, SEND_BUFFER_SIZE);
-  }
-
-  if (this->input_buffer_ != nullptr) {
-    memset(this->input_buffer_, 0, INPUT_BUFFER_SIZE * sizeof(int16_t));
+  if (this->reader_ != nullptr) {
+    this->reader_->clear();
   }
 
-  if (this->ring_buffer_ != nullptr) {
-    this->ring_buffer_->reset();
+#ifdef USE_ESP_ADF
+  if (this->vad_reader_ != nullptr) {
+    this->vad_reader_->clear();
   }
+#endif
 
 #ifdef USE_SPEAKER
   if (this->speaker_buffer_ != nullptr) {
@@ -138,13 +131,9 @@ void VoiceAssistant::clear_buffers_() {
 }
 
 void VoiceAssistant::deallocate_buffers_() {
-  ExternalRAMAllocator<uint8_t> send_deallocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
-  send_deallocator.deallocate(this->send_buffer_, SEND_BUFFER_SIZE);
-  this->send_buffer_ = nullptr;
-
-  if (this->ring_buffer_ != nullptr) {
-    this->ring_buffer_.reset();
-    this->ring_buffer_ = nullptr;
+  if (this->reader_ != nullptr) {
+    this->mic_->remove_reader(this->reader_);
+    this->reader_ = nullptr;
   }
 
 #ifdef USE_ESP_ADF
@@ -152,11 +141,16 @@ void VoiceAssistant::deallocate_buffers_() {
     vad_destroy(this->vad_instance_);
     this->vad_instance_ = nullptr;
   }
-#endif
 
-  ExternalRAMAllocator<int16_t> input_deallocator(ExternalRAMAllocator<int16_t>::ALLOW_FAILURE);
-  input_deallocator.deallocate(this->input_buffer_, INPUT_BUFFER_SIZE);
-  this->input_buffer_ = nullptr;
+  if (this->vad_reader_ != nullptr) {
+    this->mic_->remove_reader(this->vad_reader_);
+    this->vad_reader_ = nullptr;
+  }
+
+  ExternalRAMAllocator<int16_t> vad_deallocator(ExternalRAMAllocator<int16_t>::ALLOW_FAILURE);
+  vad_deallocator.deallocate(this->vad_buffer_, VAD_FRAME_SAMPLES);
+  this->vad_buffer_ = nullptr;
+#endif
 
 #ifdef USE_SPEAKER
   if (this->speaker_buffer_ != nullptr) {
@@ -172,22 +166,6 @@ void VoiceAssistant::reset_conversation_id() {
   ESP_LOGD(TAG, "reset conversation ID");
 }
 
-int VoiceAssistant::read_microphone_() {
-  size_t bytes_read = 0;
-  if (this->mic_->is_running()) {  // Read audio into input buffer
-    bytes_read = this->mic_->read(this->input_buffer_, INPUT_BUFFER_SIZE * sizeof(int16_t));
-    if (bytes_read == 0) {
-      memset(this->input_buffer_, 0, INPUT_BUFFER_SIZE * sizeof(int16_t));
-      return 0;
-    }
-    // Write audio into ring buffer
-    this->ring_buffer_->write((void *) this->input_buffer_, bytes_read);
-  } else {
-    ESP_LOGD(TAG, "microphone not running");
-  }
-  return bytes_read;
-}
-
 void VoiceAssistant::loop() {
   if (this->api_client_ == nullptr && this->state_ != State::IDLE && this->state_ != State::STOP_MICROPHONE &&
       this->state_ != State::STOPPING_MICROPHONE) {
@@ -242,16 +220,25 @@ void VoiceAssistant::loop() {
     }
 #ifdef USE_ESP_ADF
     case State::WAIT_FOR_VAD: {
-      this->read_microphone_();
+      this->vad_reader_->clear();
       ESP_LOGD(TAG, "Waiting for speech...");
       this->set_state_(State::WAITING_FOR_VAD);
       break;
     }
     case State::WAITING_FOR_VAD: {
-      size_t bytes_read = this->read_microphone_();
-      if (bytes_read > 0) {
-        vad_state_t vad_state =
-            vad_process(this->vad_instance_, this->input_buffer_, SAMPLE_RATE_HZ, VAD_FRAME_LENGTH_MS);
+      // The VAD has its own reader, the audio stays buffered for streaming once speech is detected
+      while (this->state_ == State::WAITING_FOR_VAD && this->vad_reader_->available() >= VAD_FRAME_SAMPLES) {
+        const int16_t *frame;
+        const size_t contiguous = this->vad_reader_->acquire(&frame, VAD_FRAME_SAMPLES);
+        if (contiguous < VAD_FRAME_SAMPLES) {
+          this->vad_reader_->read(this->vad_buffer_, VAD_FRAME_SAMPLES);
+          frame = this->vad_buffer_;
+        }
+        vad_state_t vad_state = vad_process(this->vad_instance_, const_cast<int16_t *>(frame), SAMPLE_RATE_HZ,
+                                            VAD_FRAME_LENGTH_MS);
+        if (frame != this->vad_buffer_) {
+          this->vad_reader_->release(contiguous);
+        }
         if (vad_state == VAD_SPEECH) {
           if (this->vad_counter_ < this->vad_threshold_) {
             this->vad_counter_++;
@@ -272,7 +259,6 @@ void VoiceAssistant::loop() {
     }
 #endif
     case State::START_PIPELINE: {
-      this->read_microphone_();
       ESP_LOGD(TAG, "Requesting start...");
       uint32_t flags = 0;
       if (this->use_wake_word_)
@@ -305,17 +291,17 @@ void VoiceAssistant::loop() {
       break;
     }
     case State::STARTING_PIPELINE: {
-      this->read_microphone_();
       break;  // State changed when udp server port received
     }
     case State::STREAMING_MICROPHONE: {
-      this->read_microphone_();
-      size_t available = this->ring_buffer_->available();
-      while (available >= SEND_BUFFER_SIZE) {
-        size_t read_bytes = this->ring_buffer_->read((void *) this->send_buffer_, SEND_BUFFER_SIZE, 0);
+      while (this->reader_->available() >= SEND_SAMPLES) {
+        // Send straight from the capture buffer, a chunk that wraps around its end goes out in two parts
+        const int16_t *samples;
+        const size_t len = this->reader_->acquire(&samples, SEND_SAMPLES);
+        const size_t bytes = len * sizeof(int16_t);
         if (this->audio_mode_ == AUDIO_MODE_API) {
           api::VoiceAssistantAudio msg;
-          msg.data.assign((char *) this->send_buffer_, read_bytes);
+          msg.data.assign((const char *) samples, bytes);
           this->api_client_->send_voice_assistant_audio(msg);
         } else {
           if (!this->udp_socket_running_) {
@@ -324,10 +310,9 @@ void VoiceAssistant::loop() {
               break;
             }
           }
-          this->socket_->sendto(this->send_buffer_, read_bytes, 0, (struct sockaddr *) &this->dest_addr_,
-                                sizeof(this->dest_addr_));
+          this->socket_->sendto(samples, bytes, 0, (struct sockaddr *) &this->dest_addr_, sizeof(this->dest_addr_));
         }
-        available = this->ring_buffer_->available();
+        this->reader_->release(len);
       }
 
       break;
@@ -726,7 +711,7 @@ void VoiceAssistant::on_event(const api::VoiceAssistantEventResponse &msg) {
     case api::enums::VOICE_ASSISTANT_RUN_END: {
       ESP_LOGD(TAG, "Assist Pipeline ended");
       if (this->state_ == State::STREAMING_MICROPHONE) {
-        this->ring_buffer_->reset();
+        this->reader_->clear();
 #ifdef USE_ESP_ADF
         if (this->use_wake_word_) {
           // No need to stop the microphone since we didn't use the speaker
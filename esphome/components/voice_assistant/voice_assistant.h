@@ -7,7 +7,6 @@
 #include "esphome/core/automation.h"
 #include "esphome/core/component.h"
 #include "esphome/core/helpers.h"
-#include "esphome/core/ring_buffer.h"
 
 #include "esphome/components/api/api_connection.h"
 #include "esphome/components/api/api_pb2.h"
@@ -205,7 +204,6 @@ class VoiceAssistant : public Component {
   void clear_buffers_();
   void deallocate_buffers_();
 
-  int read_microphone_();
   void set_state_(State state);
   void set_state_(State state, State desired_state);
   void signal_stop_();
@@ -273,8 +271,11 @@ class VoiceAssistant : public Component {
   vad_handle_t vad_instance_;
   uint8_t vad_threshold_{5};
   uint8_t vad_counter_{0};
+  microphone::CaptureReader *vad_reader_{nullptr};
+  // Holds a VAD frame that wraps around the end of the capture buffer.
+  int16_t *vad_buffer_{nullptr};
 #endif
-  std::unique_ptr<RingBuffer> ring_buffer_;
+  microphone::CaptureReader *reader_{nullptr};
 
   bool use_wake_word_;
   uint8_t noise_suppression_level_;
@@ -282,9 +283,6 @@ class VoiceAssistant : public Component {
   float volume_multiplier_;
   uint32_t conversation_timeout_;
 
-  uint8_t *send_buffer_{nullptr};
-  int16_t *input_buffer_{nullptr};
-
   bool continuous_{false};
   bool silence_detection_;
 
@@ -0,0 +1,31 @@
+#include "voltage_sampler.h"
+
+#include "esphome/core/hal.h"
+
+#include <cmath>
+
+namespace esphome {
+namespace voltage_sampler {
+
+size_t VoltageSampler::sample_block(float *samples, size_t count, uint32_t interval_us, uint32_t max_duration_us) {
+  size_t stored = 0;
+  const uint32_t start = micros();
+  uint32_t next = start;
+  for (size_t i = 0; i < count; i++) {
+    if (i != 0 && micros() - start >= max_duration_us)
+      break;
+    // Wait relative to the schedule rather than the previous reading, so the time sample() takes does not add up.
+    const int32_t wait = int32_t(next - micros());
+    if (wait > 0)
+      delayMicroseconds(wait);
+    next += interval_us;
+
+    const float value = this->sample();
+    if (!std::isnan(value))
+      samples[stored++] = value;
+  }
+  return stored;
+}
+
+}  // namespace voltage_sampler
+}  // namespace esphome
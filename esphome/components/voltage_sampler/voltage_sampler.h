@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+
 #include "esphome/core/component.h"
 
 namespace esphome {
@@ -10,6 +13,17 @@ class VoltageSampler {
  public:
   /// Get a voltage reading, in V.
   virtual float sample() = 0;
+
+  /** Take up to \p count readings spaced \p interval_us apart and store them in \p samples, in V.
+   *
+   * The default implementation paces sample() with micros(); if a single reading takes longer than the interval
+   * the readings are taken back to back. No further reading is started once \p max_duration_us have passed since
+   * the first one, so a slow source does not block the main loop for count readings. Failed (NaN) readings are
+   * skipped, so fewer than \p count samples may be stored.
+   *
+   * @return The number of samples stored.
+   */
+  virtual size_t sample_block(float *samples, size_t count, uint32_t interval_us, uint32_t max_duration_us);
 };
 
 }  // namespace voltage_sampler
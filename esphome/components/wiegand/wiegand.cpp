@@ -8,22 +8,18 @@ namespace wiegand {
 static const char *const TAG = "wiegand";
 static const char *const KEYS = "0123456789*#";
 
+static const uint32_t FRAME_TIMEOUT_US = 100000;
+
 void IRAM_ATTR HOT WiegandStore::d0_gpio_intr(WiegandStore *arg) {
   if (arg->d0.digital_read())
     return;
-  arg->count++;
-  arg->value <<= 1;
-  arg->last_bit_time = millis();
-  arg->done = false;
+  arg->bits.push(EdgeEvent{micros(), 0, false});
 }
 
 void IRAM_ATTR HOT WiegandStore::d1_gpio_intr(WiegandStore *arg) {
   if (arg->d1.digital_read())
     return;
-  arg->count++;
-  arg->value = (arg->value << 1) | 1;
-  arg->last_bit_time = millis();
-  arg->done = false;
+  arg->bits.push(EdgeEvent{micros(), 1, false});
 }
 
 void Wiegand::setup() {
@@ -56,15 +52,33 @@ bool check_oparity(uint64_t value, int start, int length) {
 }
 
 void Wiegand::loop() {
-  if (this->store_.done)
-    return;
-  if (millis() - this->store_.last_bit_time < 100)
+  if (this->store_.bits.take_dropped() != 0)
+    this->dropped_bits_ = true;
+
+  EdgeEvent bit;
+  while (this->store_.bits.pop(bit)) {
+    // The previous frame ended before this bit, it just was not processed yet.
+    if (this->count_ != 0 && bit.timestamp - this->last_bit_time_ >= FRAME_TIMEOUT_US)
+      this->finish_frame_();
+    this->value_ = (this->value_ << 1) | bit.pin;
+    this->count_++;
+    this->last_bit_time_ = bit.timestamp;
+  }
+
+  if (this->count_ != 0 && micros() - this->last_bit_time_ >= FRAME_TIMEOUT_US)
+    this->finish_frame_();
+}
+
+void Wiegand::finish_frame_() {
+  const uint8_t count = this->count_;
+  uint64_t value = this->value_;
+  this->count_ = 0;
+  this->value_ = 0;
+  if (this->dropped_bits_) {
+    this->dropped_bits_ = false;
+    ESP_LOGW(TAG, "Bits were lost, discarding %d-bit value", count);
     return;
-  uint8_t count = this->store_.count;
-  uint64_t value = this->store_.value;
-  this->store_.count = 0;
-  this->store_.value = 0;
-  this->store_.done = true;
+  }
   ESP_LOGV(TAG, "received %d-bit value: %llx", count, value);
   for (auto *trigger : this->raw_triggers_)
     trigger->trigger(count, value);
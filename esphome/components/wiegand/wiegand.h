@@ -4,6 +4,7 @@
 #include "esphome/core/automation.h"
 #include "esphome/core/component.h"
 #include "esphome/core/hal.h"
+#include "esphome/core/isr_queue.h"
 
 namespace esphome {
 namespace wiegand {
@@ -13,10 +14,8 @@ class Wiegand;
 struct WiegandStore {
   ISRInternalGPIOPin d0;
   ISRInternalGPIOPin d1;
-  volatile uint64_t value{0};
-  volatile uint32_t last_bit_time{0};
-  volatile bool done{true};
-  volatile uint8_t count{0};
+  /// Falling edges on D0 (pin 0) and D1 (pin 1), one per received bit.
+  ISRQueue<EdgeEvent, 64> bits;
 
   static void d0_gpio_intr(WiegandStore *arg);
   static void d1_gpio_intr(WiegandStore *arg);
@@ -42,9 +41,17 @@ class Wiegand : public key_provider::KeyProvider, public Component {
   void register_key_trigger(WiegandKeyTrigger *trig) { this->key_triggers_.push_back(trig); }
 
  protected:
+  /// Decode the received frame, fire the triggers and start a new one.
+  void finish_frame_();
+
   InternalGPIOPin *d0_pin_;
   InternalGPIOPin *d1_pin_;
   WiegandStore store_{};
+  /// The frame being received, it ends after 100ms without a bit.
+  uint64_t value_{0};
+  uint32_t last_bit_time_{0};
+  uint8_t count_{0};
+  bool dropped_bits_{false};
   std::vector<WiegandTagTrigger *> tag_triggers_;
   std::vector<WiegandRawTrigger *> raw_triggers_;
   std::vector<WiegandKeyTrigger *> key_triggers_;
@@ -4,8 +4,8 @@
 
 #ifdef USE_ESP32
 
+#include <cinttypes>
 #include <vector>
-#include "mbedtls/ccm.h"
 
 namespace esphome {
 namespace xiaomi_ble {
@@ -249,93 +249,76 @@ optional<XiaomiParseResult> parse_xiaomi_header(const esp32_ble_tracker::Service
 }
 
 bool decrypt_xiaomi_payload(std::vector<uint8_t> &raw, const uint8_t *bindkey, const uint64_t &address) {
+  XiaomiCipher cipher;
+  if (!cipher.set_key(bindkey))
+    return false;
+  return cipher.decrypt(raw, address, raw);
+}
+
+bool XiaomiCipher::set_key(const uint8_t *bindkey) {
+  this->has_key_ = mbedtls_ccm_setkey(&this->ctx_, MBEDTLS_CIPHER_ID_AES, bindkey, 128) == 0;
+  if (!this->has_key_)
+    ESP_LOGW(TAG, "Setting the bindkey failed");
+  return this->has_key_;
+}
+
+bool XiaomiCipher::decrypt(const std::vector<uint8_t> &raw, uint64_t address, std::vector<uint8_t> &out) {
+  if (!this->has_key_)
+    return false;
   if ((raw.size() != 19) && ((raw.size() < 22) || (raw.size() > 24))) {
     ESP_LOGVV(TAG, "decrypt_xiaomi_payload(): data packet has wrong size (%d)!", raw.size());
     ESP_LOGVV(TAG, "  Packet : %s", format_hex_pretty(raw.data(), raw.size()).c_str());
     return false;
   }
 
-  uint8_t mac_reverse[6] = {0};
-  mac_reverse[5] = (uint8_t) (address >> 40);
-  mac_reverse[4] = (uint8_t) (address >> 32);
-  mac_reverse[3] = (uint8_t) (address >> 24);
-  mac_reverse[2] = (uint8_t) (address >> 16);
-  mac_reverse[1] = (uint8_t) (address >> 8);
-  mac_reverse[0] = (uint8_t) (address >> 0);
-
-  XiaomiAESVector vector{.key = {0},
-                         .plaintext = {0},
-                         .ciphertext = {0},
-                         .authdata = {0x11},
-                         .iv = {0},
-                         .tag = {0},
-                         .keysize = 16,
-                         .authsize = 1,
-                         .datasize = 0,
-                         .tagsize = 4,
-                         .ivsize = 12};
-
-  vector.datasize = (raw.size() == 19) ? raw.size() - 12 : raw.size() - 18;
-  int cipher_pos = (raw.size() == 19) ? 5 : 11;
-
+  static const uint8_t AUTHDATA = 0x11;
+  static const size_t TAG_SIZE = 4;
+  static const size_t IV_SIZE = 12;
+  const size_t datasize = (raw.size() == 19) ? raw.size() - 12 : raw.size() - 18;
+  const size_t cipher_pos = (raw.size() == 19) ? 5 : 11;
   const uint8_t *v = raw.data();
 
-  memcpy(vector.key, bindkey, vector.keysize);
-  memcpy(vector.ciphertext, v + cipher_pos, vector.datasize);
-  memcpy(vector.tag, v + raw.size() - vector.tagsize, vector.tagsize);
-  memcpy(vector.iv, mac_reverse, 6);             // MAC address reverse
-  memcpy(vector.iv + 6, v + 2, 3);               // sensor type (2) + packet id (1)
-  memcpy(vector.iv + 9, v + raw.size() - 7, 3);  // payload counter
-
-  mbedtls_ccm_context ctx;
-  mbedtls_ccm_init(&ctx);
-
-  int ret = mbedtls_ccm_setkey(&ctx, MBEDTLS_CIPHER_ID_AES, vector.key, vector.keysize * 8);
+  uint8_t iv[IV_SIZE];
+  // MAC address reverse
+  for (uint8_t i = 0; i < 6; i++)
+    iv[i] = (uint8_t) (address >> (i * 8));
+  memcpy(iv + 6, v + 2, 3);               // sensor type (2) + packet id (1)
+  memcpy(iv + 9, v + raw.size() - 7, 3);  // payload counter
+
+  // At most 7 bytes, decrypt to the stack so that out may alias raw
+  uint8_t plaintext[16];
+  int ret = mbedtls_ccm_auth_decrypt(&this->ctx_, datasize, iv, IV_SIZE, &AUTHDATA, 1, v + cipher_pos, plaintext,
+                                     v + raw.size() - TAG_SIZE, TAG_SIZE);
   if (ret) {
-    ESP_LOGVV(TAG, "decrypt_xiaomi_payload(): mbedtls_ccm_setkey() failed.");
-    mbedtls_ccm_free(&ctx);
-    return false;
-  }
-
-  ret = mbedtls_ccm_auth_decrypt(&ctx, vector.datasize, vector.iv, vector.ivsize, vector.authdata, vector.authsize,
-                                 vector.ciphertext, vector.plaintext, vector.tag, vector.tagsize);
-  if (ret) {
-    uint8_t mac_address[6] = {0};
-    memcpy(mac_address, mac_reverse + 5, 1);
-    memcpy(mac_address + 1, mac_reverse + 4, 1);
-    memcpy(mac_address + 2, mac_reverse + 3, 1);
-    memcpy(mac_address + 3, mac_reverse + 2, 1);
-    memcpy(mac_address + 4, mac_reverse + 1, 1);
-    memcpy(mac_address + 5, mac_reverse, 1);
     ESP_LOGVV(TAG, "decrypt_xiaomi_payload(): authenticated decryption failed.");
-    ESP_LOGVV(TAG, "  MAC address : %s", format_hex_pretty(mac_address, 6).c_str());
+    ESP_LOGVV(TAG, "  MAC address : %012" PRIX64, address);
     ESP_LOGVV(TAG, "       Packet : %s", format_hex_pretty(raw.data(), raw.size()).c_str());
-    ESP_LOGVV(TAG, "          Key : %s", format_hex_pretty(vector.key, vector.keysize).c_str());
-    ESP_LOGVV(TAG, "           Iv : %s", format_hex_pretty(vector.iv, vector.ivsize).c_str());
-    ESP_LOGVV(TAG, "       Cipher : %s", format_hex_pretty(vector.ciphertext, vector.datasize).c_str());
-    ESP_LOGVV(TAG, "          Tag : %s", format_hex_pretty(vector.tag, vector.tagsize).c_str());
-    mbedtls_ccm_free(&ctx);
+    ESP_LOGVV(TAG, "           Iv : %s", format_hex_pretty(iv, IV_SIZE).c_str());
     return false;
   }
 
+  if (&out != &raw)
+    out.assign(raw.begin(), raw.end());
   // replace encrypted payload with plaintext
-  uint8_t *p = vector.plaintext;
-  for (std::vector<uint8_t>::iterator it = raw.begin() + cipher_pos; it != raw.begin() + cipher_pos + vector.datasize;
-       ++it) {
-    *it = *(p++);
-  }
-
+  memcpy(out.data() + cipher_pos, plaintext, datasize);
   // clear encrypted flag
-  raw[0] &= ~0x08;
+  out[0] &= ~0x08;
 
   ESP_LOGVV(TAG, "decrypt_xiaomi_payload(): authenticated decryption passed.");
-  ESP_LOGVV(TAG, "  Plaintext : %s, Packet : %d", format_hex_pretty(raw.data() + cipher_pos, vector.datasize).c_str(),
-            static_cast<int>(raw[4]));
-
-  mbedtls_ccm_free(&ctx);
+  ESP_LOGVV(TAG, "  Plaintext : %s, Packet : %d", format_hex_pretty(out.data() + cipher_pos, datasize).c_str(),
+            static_cast<int>(out[4]));
   return true;
 }
 
+const std::vector<uint8_t> *XiaomiCipher::get_message(const std::vector<uint8_t> &raw, const XiaomiParseResult &result,
+                                                      uint64_t address) {
+  if (!result.has_encryption)
+    return &raw;
+  if (!this->decrypt(raw, address, this->decrypted_))
+    return nullptr;
+  return &this->decrypted_;
+}
+
 bool report_xiaomi_results(const optional<XiaomiParseResult> &result, const std::string &address) {
   if (!result.has_value()) {
     ESP_LOGVV(TAG, "report_xiaomi_results(): no results available.");
@@ -7,6 +7,8 @@
 
 #ifdef USE_ESP32
 
+#include "mbedtls/ccm.h"
+
 namespace esphome {
 namespace xiaomi_ble {
 
@@ -70,6 +72,35 @@ bool parse_xiaomi_value(uint16_t value_type, const uint8_t *data, uint8_t value_
 bool parse_xiaomi_message(const std::vector<uint8_t> &message, XiaomiParseResult &result);
 optional<XiaomiParseResult> parse_xiaomi_header(const esp32_ble_tracker::ServiceData &service_data);
 bool decrypt_xiaomi_payload(std::vector<uint8_t> &raw, const uint8_t *bindkey, const uint64_t &address);
+
+/// AES-CCM context for one bindkey. The key schedule is computed once in set_key() instead of for every packet.
+class XiaomiCipher {
+ public:
+  XiaomiCipher() { mbedtls_ccm_init(&this->ctx_); }
+  ~XiaomiCipher() { mbedtls_ccm_free(&this->ctx_); }
+  XiaomiCipher(const XiaomiCipher &) = delete;
+  XiaomiCipher &operator=(const XiaomiCipher &) = delete;
+
+  bool set_key(const uint8_t *bindkey);
+  /** Decrypt and authenticate an encrypted service data packet.
+   *
+   * On success \p out holds a copy of \p raw with the plaintext payload and the encryption flag cleared, ready for
+   * parse_xiaomi_message(). \p out may be \p raw itself; reusing the same buffer avoids allocations.
+   */
+  bool decrypt(const std::vector<uint8_t> &raw, uint64_t address, std::vector<uint8_t> &out);
+  /** Get the message of a service data packet to pass to parse_xiaomi_message().
+   *
+   * That is \p raw itself, or for an encrypted packet its decrypted copy in a buffer that is reused for every packet.
+   * Returns nullptr if the packet can't be decrypted.
+   */
+  const std::vector<uint8_t> *get_message(const std::vector<uint8_t> &raw, const XiaomiParseResult &result,
+                                          uint64_t address);
+
+ protected:
+  mbedtls_ccm_context ctx_;
+  bool has_key_{false};
+  std::vector<uint8_t> decrypted_;
+};
 bool report_xiaomi_results(const optional<XiaomiParseResult> &result, const std::string &address);
 
 class XiaomiListener : public esp32_ble_tracker::ESPBTDeviceListener {
@@ -32,12 +32,8 @@ bool XiaomiCGPR1::parse_device(const esp32_ble_tracker::ESPBTDevice &device) {
     if (res->is_duplicate) {
       continue;
     }
-    if (res->has_encryption &&
-        (!(xiaomi_ble::decrypt_xiaomi_payload(const_cast<std::vector<uint8_t> &>(service_data.data), this->bindkey_,
-                                              this->address_)))) {
-      continue;
-    }
-    if (!(xiaomi_ble::parse_xiaomi_message(service_data.data, *res))) {
+    const std::vector<uint8_t> *message = this->cipher_.get_message(service_data.data, *res, this->address_);
+    if (message == nullptr || !(xiaomi_ble::parse_xiaomi_message(*message, *res))) {
       continue;
     }
     if (!(xiaomi_ble::report_xiaomi_results(res, device.address_str()))) {
@@ -67,6 +63,7 @@ void XiaomiCGPR1::set_bindkey(const std::string &bindkey) {
     strncpy(temp, &(bindkey.c_str()[i * 2]), 2);
     bindkey_[i] = std::strtoul(temp, nullptr, 16);
   }
+  this->cipher_.set_key(this->bindkey_);
 }
 
 }  // namespace xiaomi_cgpr1
@@ -3,6 +3,9 @@
 #include "esphome/core/version.h"
 #include "esphome/core/hal.h"
 
+#include <algorithm>
+#include <cerrno>
+
 #ifdef USE_STATUS_LED
 #include "esphome/components/status_led/status_led.h"
 #endif
@@ -83,7 +86,7 @@ void Application::loop() {
 
   auto elapsed = now - this->last_loop_;
   if (elapsed >= this->loop_interval_ || HighFrequencyLoopRequester::is_high_frequency()) {
-    yield();
+    this->yield_with_select_(0);
   } else {
     uint32_t delay_time = this->loop_interval_ - elapsed;
     uint32_t next_schedule = this->scheduler.next_schedule_in().value_or(delay_time);
@@ -91,7 +94,7 @@ void Application::loop() {
     // otherwise interval=0 schedules result in constant looping with almost no sleep
     next_schedule = std::max(next_schedule, delay_time / 2);
     delay_time = std::min(next_schedule, delay_time);
-    delay(delay_time);
+    this->yield_with_select_(delay_time);
   }
   this->last_loop_ = now;
 
@@ -108,6 +111,59 @@ void Application::loop() {
   }
 }
 
+void Application::yield_with_select_(uint32_t delay_ms) {
+#ifdef USE_SOCKET_SELECT_SUPPORT
+  if (!this->socket_fds_.empty()) {
+    this->read_fds_ = this->base_read_fds_;
+    struct timeval tv;
+    tv.tv_sec = delay_ms / 1000;
+    tv.tv_usec = (delay_ms % 1000) * 1000;
+    if (::select(this->max_fd_ + 1, &this->read_fds_, nullptr, nullptr, &tv) >= 0) {
+      if (delay_ms == 0)
+        yield();
+      return;
+    }
+    // Report every socket as ready rather than stalling them; reads will simply find nothing.
+    ESP_LOGV(TAG, "select() failed: errno %d", errno);
+    this->read_fds_ = this->base_read_fds_;
+  }
+#endif
+  if (delay_ms == 0) {
+    yield();
+  } else {
+    delay(delay_ms);
+  }
+}
+
+#ifdef USE_SOCKET_SELECT_SUPPORT
+bool Application::register_socket_fd(int fd) {
+  if (fd < 0 || fd >= FD_SETSIZE) {
+    ESP_LOGW(TAG, "Socket fd %d can not be monitored", fd);
+    return false;
+  }
+  this->socket_fds_.push_back(fd);
+  FD_SET(fd, &this->base_read_fds_);
+  // Treat a new socket as ready so that data that arrived before the next select() is read right away.
+  FD_SET(fd, &this->read_fds_);
+  this->max_fd_ = std::max(this->max_fd_, fd);
+  return true;
+}
+
+void Application::unregister_socket_fd(int fd) {
+  auto it = std::find(this->socket_fds_.begin(), this->socket_fds_.end(), fd);
+  if (it == this->socket_fds_.end())
+    return;
+  this->socket_fds_.erase(it);
+  FD_CLR(fd, &this->base_read_fds_);
+  FD_CLR(fd, &this->read_fds_);
+  if (fd == this->max_fd_) {
+    this->max_fd_ = -1;
+    for (int other : this->socket_fds_)
+      this->max_fd_ = std::max(this->max_fd_, other);
+  }
+}
+#endif
+
 void IRAM_ATTR HOT Application::feed_wdt() {
   static uint32_t last_feed = 0;
   uint32_t now = micros();
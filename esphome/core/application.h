@@ -9,6 +9,10 @@
 #include "esphome/core/preferences.h"
 #include "esphome/core/scheduler.h"
 
+#ifdef USE_SOCKET_SELECT_SUPPORT
+#include <sys/select.h>
+#endif
+
 #ifdef USE_BINARY_SENSOR
 #include "esphome/components/binary_sensor/binary_sensor.h"
 #endif
@@ -239,6 +243,20 @@ class Application {
 
   void safe_reboot();
 
+#ifdef USE_SOCKET_SELECT_SUPPORT
+  /** Register a socket file descriptor to be monitored by the main loop.
+   *
+   * Instead of sleeping between loop iterations, the main loop waits for any registered socket to become
+   * readable, so that incoming data is handled without waiting for the next loop interval.
+   *
+   * @return false if the file descriptor cannot be monitored, in which case the socket has to be polled.
+   */
+  bool register_socket_fd(int fd);
+  void unregister_socket_fd(int fd);
+  /// Whether a registered socket was readable (or had a pending connection) when the main loop last checked.
+  bool is_socket_ready(int fd) const { return fd >= 0 && fd < FD_SETSIZE && FD_ISSET(fd, &this->read_fds_); }
+#endif
+
   void run_safe_shutdown_hooks();
 
   uint32_t get_app_state() const { return this->app_state_; }
@@ -470,6 +488,9 @@ class Application {
 
   void feed_wdt_arch_();
 
+  /// Sleep for \p delay_ms, or just yield if 0, returning early if a registered socket becomes readable.
+  void yield_with_select_(uint32_t delay_ms);
+
   std::vector<Component *> components_{};
   std::vector<Component *> looping_components_{};
 
@@ -547,6 +568,15 @@ class Application {
   uint32_t loop_interval_{16};
   size_t dump_config_at_{SIZE_MAX};
   uint32_t app_state_{0};
+
+#ifdef USE_SOCKET_SELECT_SUPPORT
+  std::vector<int> socket_fds_{};
+  /// All registered sockets, the set passed to select().
+  fd_set base_read_fds_{};
+  /// Sockets that were readable after the last select().
+  fd_set read_fds_{};
+  int max_fd_{-1};
+#endif
 };
 
 /// Global storage of Application pointer - only one Application can exist.
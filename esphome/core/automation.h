@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <vector>
 #include "esphome/core/component.h"
 #include "esphome/core/helpers.h"
@@ -76,6 +77,16 @@ template<typename... Ts> class Condition {
   /// Check whether this condition passes. This condition check must be instant, and not cause any delays.
   virtual bool check(Ts... x) = 0;
 
+  /** Register a callback that is called whenever the result of check() may have changed.
+   *
+   * Conditions over entity states forward this to the state callbacks of their entities, so waiting for them does
+   * not require polling. Spurious calls are allowed, callers always re-check.
+   *
+   * @return false if this condition cannot notify about changes (e.g. it depends on a lambda or on the trigger
+   *   arguments) and has to be polled instead.
+   */
+  virtual bool add_on_change_callback(const std::function<void()> &callback) { return false; }
+
   /// Call check with a tuple of values as parameter.
   bool check_tuple(const std::tuple<Ts...> &tuple) {
     return this->check_tuple_(tuple, typename gens<sizeof...(Ts)>::type());
@@ -21,6 +21,13 @@ template<typename... Ts> class AndCondition : public Condition<Ts...> {
     return true;
   }
 
+  bool add_on_change_callback(const std::function<void()> &callback) override {
+    bool supported = true;
+    for (auto *condition : this->conditions_)
+      supported &= condition->add_on_change_callback(callback);
+    return supported;
+  }
+
  protected:
   std::vector<Condition<Ts...> *> conditions_;
 };
@@ -37,6 +44,13 @@ template<typename... Ts> class OrCondition : public Condition<Ts...> {
     return false;
   }
 
+  bool add_on_change_callback(const std::function<void()> &callback) override {
+    bool supported = true;
+    for (auto *condition : this->conditions_)
+      supported &= condition->add_on_change_callback(callback);
+    return supported;
+  }
+
  protected:
   std::vector<Condition<Ts...> *> conditions_;
 };
@@ -45,6 +59,9 @@ template<typename... Ts> class NotCondition : public Condition<Ts...> {
  public:
   explicit NotCondition(Condition<Ts...> *condition) : condition_(condition) {}
   bool check(Ts... x) override { return !this->condition_->check(x...); }
+  bool add_on_change_callback(const std::function<void()> &callback) override {
+    return this->condition_->add_on_change_callback(callback);
+  }
 
  protected:
   Condition<Ts...> *condition_;
@@ -62,6 +79,13 @@ template<typename... Ts> class XorCondition : public Condition<Ts...> {
     return result == 1;
   }
 
+  bool add_on_change_callback(const std::function<void()> &callback) override {
+    bool supported = true;
+    for (auto *condition : this->conditions_)
+      supported &= condition->add_on_change_callback(callback);
+    return supported;
+  }
+
  protected:
   std::vector<Condition<Ts...> *> conditions_;
 };
@@ -155,9 +179,9 @@ template<typename... Ts> class DelayAction : public Action<Ts...>, public Compon
   TEMPLATABLE_VALUE(uint32_t, delay)
 
   void play_complex(Ts... x) override {
-    auto f = std::bind(&DelayAction<Ts...>::play_next_, this, x...);
     this->num_running_++;
-    this->set_timeout(this->delay_.value(x...), f);
+    // Unlike std::bind, a lambda capturing only this and small arguments fits into std::function without allocating
+    this->set_timeout(this->delay_.value(x...), [this, x...]() { this->play_next_(x...); });
   }
   float get_setup_priority() const override { return setup_priority::HARDWARE; }
 
@@ -306,12 +330,26 @@ template<typename... Ts> class RepeatAction : public Action<Ts...> {
   std::tuple<Ts...> var_;
 };
 
+/** Wait until a condition passes or the optional timeout expires.
+ *
+ * Conditions that can notify about changes (see Condition::add_on_change_callback()) are only re-evaluated when one
+ * of their inputs changed. Other conditions are polled through a scheduler interval while an action is waiting, so
+ * an idle wait_until never takes part in the main loop.
+ */
 template<typename... Ts> class WaitUntilAction : public Action<Ts...>, public Component {
  public:
   WaitUntilAction(Condition<Ts...> *condition) : condition_(condition) {}
 
   TEMPLATABLE_VALUE(uint32_t, timeout_value)
 
+  void setup() override {
+    this->event_driven_ = this->condition_->add_on_change_callback([this]() {
+      // Re-evaluate outside of the state callback so the following actions do not run nested in a publish_state().
+      if (this->num_running_ > 0)
+        this->defer("check", [this]() { this->check_(); });
+    });
+  }
+
   void play_complex(Ts... x) override {
     this->num_running_++;
     // Check if we can continue immediately.
@@ -324,36 +362,46 @@ template<typename... Ts> class WaitUntilAction : public Action<Ts...>, public Co
     this->var_ = std::make_tuple(x...);
 
     if (this->timeout_value_.has_value()) {
-      auto f = std::bind(&WaitUntilAction<Ts...>::play_next_, this, x...);
-      this->set_timeout("timeout", this->timeout_value_.value(x...), f);
+      this->set_timeout("timeout", this->timeout_value_.value(x...), [this, x...]() {
+        this->play_next_(x...);
+        if (this->num_running_ == 0)
+          this->cancel_interval("poll");
+      });
     }
 
-    this->loop();
+    if (!this->event_driven_)
+      this->set_interval("poll", 0, [this]() { this->check_(); });
   }
 
-  void loop() override {
-    if (this->num_running_ == 0)
-      return;
+  float get_setup_priority() const override { return setup_priority::DATA; }
 
-    if (!this->condition_->check_tuple(this->var_)) {
-      return;
-    }
+  void play(Ts... x) override { /* ignore - see play_complex */
+  }
 
+  void stop() override {
     this->cancel_timeout("timeout");
-
-    this->play_next_tuple_(this->var_);
+    this->cancel_interval("poll");
   }
 
-  float get_setup_priority() const override { return setup_priority::DATA; }
+ protected:
+  void check_() {
+    if (this->num_running_ == 0 || !this->condition_->check_tuple(this->var_))
+      return;
 
-  void play(Ts... x) override { /* ignore - see play_complex */
-  }
+    this->cancel_timeout("timeout");
+    this->play_next_tuple_(this->var_);
 
-  void stop() override { this->cancel_timeout("timeout"); }
+    if (this->num_running_ == 0) {
+      this->cancel_interval("poll");
+    } else if (this->event_driven_) {
+      // Release the remaining waiters one per loop iteration, there may be no further change to wake them.
+      this->defer("check", [this]() { this->check_(); });
+    }
+  }
 
- protected:
   Condition<Ts...> *condition_;
   std::tuple<Ts...> var_{};
+  bool event_driven_{false};
 };
 
 template<typename... Ts> class UpdateComponentAction : public Action<Ts...> {
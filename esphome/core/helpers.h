@@ -491,26 +491,90 @@ constexpr float fahrenheit_to_celsius(float value) { return (value - 32.0f) / 1.
 template<typename... X> class CallbackManager;
 
 /** Helper class to allow having multiple subscribers to a callback.
+ *
+ * Callbacks are kept in a singly linked list of nodes that store the callable itself, so adding a lambda costs a
+ * single allocation of exactly its size and an empty manager is just one pointer. Callables passed as
+ * std::function are stored as-is, callers that want to avoid the std::function wrapper should forward the lambda
+ * type to add() (see e.g. Sensor::add_on_state_callback()).
  *
  * @tparam Ts The arguments for the callbacks, wrapped in void().
  */
 template<typename... Ts> class CallbackManager<void(Ts...)> {
  public:
+  CallbackManager() = default;
+  CallbackManager(const CallbackManager &other) { this->copy_from_(other); }
+  CallbackManager(CallbackManager &&other) noexcept : head_(other.head_) { other.head_ = nullptr; }
+  CallbackManager &operator=(const CallbackManager &other) {
+    if (this != &other) {
+      this->clear_();
+      this->copy_from_(other);
+    }
+    return *this;
+  }
+  CallbackManager &operator=(CallbackManager &&other) noexcept {
+    if (this != &other) {
+      this->clear_();
+      this->head_ = other.head_;
+      other.head_ = nullptr;
+    }
+    return *this;
+  }
+  ~CallbackManager() { this->clear_(); }
+
   /// Add a callback to the list.
-  void add(std::function<void(Ts...)> &&callback) { this->callbacks_.push_back(std::move(callback)); }
+  template<typename F> void add(F &&callback) {
+    this->append_(new Node<typename std::decay<F>::type>(std::forward<F>(callback)));  // NOLINT
+  }
 
   /// Call all callbacks in this manager.
   void call(Ts... args) {
-    for (auto &cb : this->callbacks_)
-      cb(args...);
+    for (NodeBase *node = this->head_; node != nullptr; node = node->next)
+      node->call(args...);
+  }
+  size_t size() const {
+    size_t count = 0;
+    for (NodeBase *node = this->head_; node != nullptr; node = node->next)
+      count++;
+    return count;
   }
-  size_t size() const { return this->callbacks_.size(); }
 
   /// Call all callbacks in this manager.
   void operator()(Ts... args) { call(args...); }
 
  protected:
-  std::vector<std::function<void(Ts...)>> callbacks_;
+  struct NodeBase {
+    virtual ~NodeBase() = default;
+    virtual void call(Ts... args) = 0;
+    virtual NodeBase *clone() const = 0;
+    NodeBase *next{nullptr};
+  };
+  template<typename F> struct Node final : NodeBase {
+    template<typename U> explicit Node(U &&callback) : callback(std::forward<U>(callback)) {}
+    void call(Ts... args) override { this->callback(std::forward<Ts>(args)...); }
+    NodeBase *clone() const override { return new Node(this->callback); }  // NOLINT
+    F callback;
+  };
+
+  void append_(NodeBase *node) {
+    // Callbacks are added during setup only, walking the list keeps the manager itself a single pointer.
+    NodeBase **tail = &this->head_;
+    while (*tail != nullptr)
+      tail = &(*tail)->next;
+    *tail = node;
+  }
+  void copy_from_(const CallbackManager &other) {
+    for (NodeBase *node = other.head_; node != nullptr; node = node->next)
+      this->append_(node->clone());
+  }
+  void clear_() {
+    while (this->head_ != nullptr) {
+      NodeBase *next = this->head_->next;
+      delete this->head_;  // NOLINT
+      this->head_ = next;
+    }
+  }
+
+  NodeBase *head_{nullptr};
 };
 
 /// Helper class to deduplicate items in a series of values.
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+
+/// A GPIO edge captured in an interrupt handler.
+struct EdgeEvent {
+  /// micros() when the interrupt handler ran.
+  uint32_t timestamp;
+  /// Identifies the source, e.g. an index into the pins of the component.
+  uint8_t pin;
+  /// Pin level after the edge.
+  bool level;
+};
+
+/** Fixed size, lock-free queue for passing events from an interrupt handler to the main loop.
+ *
+ * push() may only be called from interrupt handlers that cannot preempt each other (all GPIO interrupts of a
+ * component), pop() only from the main loop. Events that do not fit are dropped and counted, so the consumer can
+ * report the loss instead of silently working with a truncated stream. Nothing is allocated and push() is always
+ * inlined into the (IRAM) interrupt handler.
+ *
+ * @tparam T Trivially copyable event type, usually EdgeEvent.
+ * @tparam N Capacity, must be a power of two.
+ */
+template<typename T, size_t N> class ISRQueue {
+  static_assert(N >= 2 && (N & (N - 1)) == 0, "ISRQueue capacity must be a power of two");
+
+ public:
+  /// Add an event from the interrupt handler, returns false if the queue was full and the event was dropped.
+  inline bool push(const T &event) ESPHOME_ALWAYS_INLINE {
+    const uint32_t head = this->head_.load(std::memory_order_relaxed);
+    if (head - this->tail_.load(std::memory_order_acquire) >= N) {
+      this->dropped_.store(this->dropped_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+      return false;
+    }
+    this->events_[head & (N - 1)] = event;
+    this->head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  /// Take the oldest event, returns false if the queue is empty.
+  bool pop(T &event) {
+    const uint32_t tail = this->tail_.load(std::memory_order_relaxed);
+    if (tail == this->head_.load(std::memory_order_acquire))
+      return false;
+    event = this->events_[tail & (N - 1)];
+    this->tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /// Number of queued events.
+  size_t size() const {
+    return this->head_.load(std::memory_order_acquire) - this->tail_.load(std::memory_order_relaxed);
+  }
+  bool empty() const { return this->size() == 0; }
+  static constexpr size_t capacity() { return N; }
+
+  /// Events dropped because the queue was full since the last call.
+  uint32_t take_dropped() {
+    const uint32_t dropped = this->dropped_.load(std::memory_order_relaxed);
+    const uint32_t count = dropped - this->dropped_reported_;
+    this->dropped_reported_ = dropped;
+    return count;
+  }
+
+ protected:
+  T events_[N];
+  std::atomic<uint32_t> head_{0};
+  std::atomic<uint32_t> tail_{0};
+  /// Only written by the producer, the consumer keeps its own copy of the last reported value.
+  std::atomic<uint32_t> dropped_{0};
+  uint32_t dropped_reported_{0};
+};
+
+}  // namespace esphome
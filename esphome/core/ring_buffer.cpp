@@ -1,16 +1,22 @@
 #include "ring_buffer.h"
 
+#include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
-#ifdef USE_ESP32
+#include <algorithm>
+#include <cstring>
 
-#include "helpers.h"
+#if defined(USE_ESP32) && !defined(USE_RING_BUFFER_FREERTOS)
+#include <freertos/task.h>
+#endif
 
 namespace esphome {
 
 static const char *const TAG = "ring_buffer";
 
+#ifdef USE_RING_BUFFER_FREERTOS
+
 RingBuffer::~RingBuffer() {
   if (this->handle_ != nullptr) {
     vRingbufferDelete(this->handle_);
@@ -31,7 +37,7 @@ std::unique_ptr<RingBuffer> RingBuffer::create(size_t len) {
   }
 
   rb->handle_ = xRingbufferCreateStatic(rb->size_, RINGBUF_TYPE_BYTEBUF, rb->storage_, &rb->structure_);
-  ESP_LOGD(TAG, "Created ring buffer with size %u", len);
+  ESP_LOGD(TAG, "Created ring buffer with size %zu", len);
 
   return rb;
 }
@@ -98,7 +104,7 @@ size_t RingBuffer::available() const {
 
 size_t RingBuffer::free() const { return xRingbufferGetCurFreeSize(this->handle_); }
 
-BaseType_t RingBuffer::reset() {
+bool RingBuffer::reset() {
   // Discards all the available data
   return this->discard_bytes_(this->available());
 }
@@ -122,6 +128,185 @@ bool RingBuffer::discard_bytes_(size_t discard_bytes) {
   return (bytes_read == discard_bytes);
 }
 
-}  // namespace esphome
+#else  // USE_RING_BUFFER_FREERTOS
 
+RingBuffer::~RingBuffer() {
+  if (this->storage_ != nullptr) {
+    RAMAllocator<uint8_t> allocator(RAMAllocator<uint8_t>::ALLOW_FAILURE);
+    allocator.deallocate(this->storage_, this->size_);
+  }
+}
+
+std::unique_ptr<RingBuffer> RingBuffer::create(size_t len) {
+  std::unique_ptr<RingBuffer> rb = make_unique<RingBuffer>();
+
+  rb->size_ = len;
+
+  RAMAllocator<uint8_t> allocator(RAMAllocator<uint8_t>::ALLOW_FAILURE);
+  rb->storage_ = allocator.allocate(rb->size_);
+  if (rb->storage_ == nullptr) {
+    return nullptr;
+  }
+#ifdef USE_ESP32
+  rb->data_signal_.handle = xSemaphoreCreateBinaryStatic(&rb->data_signal_.structure);
+  rb->space_signal_.handle = xSemaphoreCreateBinaryStatic(&rb->space_signal_.structure);
 #endif
+
+  ESP_LOGD(TAG, "Created ring buffer with size %zu", len);
+
+  return rb;
+}
+
+template<typename F> bool RingBuffer::wait_(Signal &signal, TickType_t ticks_to_wait, F &&ready) {
+  if (ready())
+    return true;
+#ifdef USE_ESP32
+  const TickType_t start = xTaskGetTickCount();
+  while (ticks_to_wait != 0) {
+    // Announce the wait before checking again, so a position moved in between is either seen here or notified.
+    signal.waiting.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (ready()) {
+      signal.waiting.store(false, std::memory_order_relaxed);
+      return true;
+    }
+    TickType_t remaining = portMAX_DELAY;
+    if (ticks_to_wait != portMAX_DELAY) {
+      const TickType_t elapsed = xTaskGetTickCount() - start;
+      if (elapsed >= ticks_to_wait)
+        break;
+      remaining = ticks_to_wait - elapsed;
+    }
+    // The semaphore may still be given from an earlier wake-up, so this can return early; the loop checks again.
+    xSemaphoreTake(signal.handle, remaining);
+  }
+  signal.waiting.store(false, std::memory_order_relaxed);
+#else
+  for (; ticks_to_wait != 0; ticks_to_wait--) {
+    delay(1);
+    if (ready())
+      return true;
+  }
+#endif
+  return ready();
+}
+
+void RingBuffer::notify_(Signal &signal) {
+#ifdef USE_ESP32
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (signal.waiting.load(std::memory_order_relaxed) && signal.waiting.exchange(false, std::memory_order_relaxed))
+    xSemaphoreGive(signal.handle);
+#endif
+}
+
+size_t RingBuffer::used_(size_t read_pos, size_t write_pos) const {
+  return write_pos >= read_pos ? write_pos - read_pos : write_pos + 2 * this->size_ - read_pos;
+}
+
+size_t RingBuffer::advance_(size_t pos, size_t len) const {
+  pos += len;
+  return pos >= 2 * this->size_ ? pos - 2 * this->size_ : pos;
+}
+
+size_t RingBuffer::read(void *data, size_t len, TickType_t ticks_to_wait) {
+  // Like the FreeRTOS byte buffer: only wait while there is no data at all, then return what is there
+  this->wait_(this->data_signal_, ticks_to_wait, [this]() { return this->available() > 0; });
+  while (true) {
+    size_t read_pos = this->read_pos_.load(std::memory_order_acquire);
+    const size_t available = this->used_(read_pos, this->write_pos_.load(std::memory_order_acquire));
+
+    const size_t bytes_read = std::min(len, available);
+    const size_t index = read_pos < this->size_ ? read_pos : read_pos - this->size_;
+    const size_t first = std::min(bytes_read, this->size_ - index);
+    std::memcpy(data, this->storage_ + index, first);
+    std::memcpy(static_cast<uint8_t *>(data) + first, this->storage_, bytes_read - first);
+
+    // The read position only moves under us if the producer overwrote the data we just copied, so try again.
+    if (this->read_pos_.compare_exchange_strong(read_pos, this->advance_(read_pos, bytes_read),
+                                                std::memory_order_acq_rel)) {
+      this->notify_(this->space_signal_);
+      return bytes_read;
+    }
+  }
+}
+
+size_t RingBuffer::write(const void *data, size_t len) {
+  size_t free = this->free();
+  if (free < len) {
+    // Free enough space in the ring buffer to fit the new data
+    this->discard_bytes_(len - free);
+  }
+  return this->write_without_replacement(data, len, 0);
+}
+
+size_t RingBuffer::write_without_replacement(const void *data, size_t len, TickType_t ticks_to_wait) {
+  this->wait_(this->space_signal_, ticks_to_wait, [this, len]() { return this->free() >= len; });
+
+  // Couldn't fit all the data, so only write what will fit
+  const size_t bytes_written = std::min(len, this->free());
+  const size_t write_pos = this->write_pos_.load(std::memory_order_relaxed);
+  const size_t index = write_pos < this->size_ ? write_pos : write_pos - this->size_;
+  const size_t first = std::min(bytes_written, this->size_ - index);
+  std::memcpy(this->storage_ + index, data, first);
+  std::memcpy(this->storage_, static_cast<const uint8_t *>(data) + first, bytes_written - first);
+  this->write_pos_.store(this->advance_(write_pos, bytes_written), std::memory_order_release);
+  this->notify_(this->data_signal_);
+  return bytes_written;
+}
+
+size_t RingBuffer::available() const {
+  return this->used_(this->read_pos_.load(std::memory_order_acquire),
+                     this->write_pos_.load(std::memory_order_acquire));
+}
+
+size_t RingBuffer::free() const { return this->size_ - this->available(); }
+
+bool RingBuffer::reset() {
+  // Discards all the available data
+  return this->discard_bytes_(this->available());
+}
+
+bool RingBuffer::discard_bytes_(size_t discard_bytes) {
+  size_t read_pos = this->read_pos_.load(std::memory_order_acquire);
+  size_t discarded;
+  do {
+    discarded = std::min(discard_bytes, this->used_(read_pos, this->write_pos_.load(std::memory_order_acquire)));
+  } while (!this->read_pos_.compare_exchange_weak(read_pos, this->advance_(read_pos, discarded),
+                                                  std::memory_order_acq_rel));
+  this->notify_(this->space_signal_);
+  return discarded == discard_bytes;
+}
+
+RingBuffer::Span RingBuffer::acquire_read(size_t max_len) {
+  const size_t read_pos = this->read_pos_.load(std::memory_order_acquire);
+  const size_t available = this->used_(read_pos, this->write_pos_.load(std::memory_order_acquire));
+  const size_t index = read_pos < this->size_ ? read_pos : read_pos - this->size_;
+  return Span{this->storage_ + index, std::min({available, this->size_ - index, max_len})};
+}
+
+void RingBuffer::release_read(size_t len) {
+  size_t read_pos = this->read_pos_.load(std::memory_order_acquire);
+  size_t released;
+  do {
+    released = std::min(len, this->used_(read_pos, this->write_pos_.load(std::memory_order_acquire)));
+  } while (!this->read_pos_.compare_exchange_weak(read_pos, this->advance_(read_pos, released),
+                                                  std::memory_order_acq_rel));
+  this->notify_(this->space_signal_);
+}
+
+RingBuffer::Span RingBuffer::acquire_write(size_t max_len) {
+  const size_t write_pos = this->write_pos_.load(std::memory_order_relaxed);
+  const size_t free = this->size_ - this->used_(this->read_pos_.load(std::memory_order_acquire), write_pos);
+  const size_t index = write_pos < this->size_ ? write_pos : write_pos - this->size_;
+  return Span{this->storage_ + index, std::min({free, this->size_ - index, max_len})};
+}
+
+void RingBuffer::commit_write(size_t len) {
+  const size_t write_pos = this->write_pos_.load(std::memory_order_relaxed);
+  this->write_pos_.store(this->advance_(write_pos, len), std::memory_order_release);
+  this->notify_(this->data_signal_);
+}
+
+#endif  // USE_RING_BUFFER_FREERTOS
+
+}  // namespace esphome
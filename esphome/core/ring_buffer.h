@@ -1,24 +1,51 @@
 #pragma once
 
-#ifdef USE_ESP32
-
-#include <freertos/FreeRTOS.h>
-#include <freertos/ringbuf.h>
+#include "esphome/core/defines.h"
 
+#include <atomic>
 #include <cinttypes>
+#include <cstddef>
 #include <memory>
 
+#ifdef USE_ESP32
+#include <freertos/FreeRTOS.h>
+#ifdef USE_RING_BUFFER_FREERTOS
+#include <freertos/ringbuf.h>
+#else
+#include <freertos/semphr.h>
+#endif
+#endif
+
 namespace esphome {
 
+#ifndef USE_ESP32
+/// Platforms without FreeRTOS count ticks in milliseconds.
+using TickType_t = uint32_t;
+#endif
+
+/** Byte ring buffer for passing a stream of data from one task to another.
+ *
+ * By default this is a lock-free single-producer/single-consumer buffer that works on every platform: exactly one
+ * task may write and exactly one task may read at any time. On ESP32 the FreeRTOS byte ring buffer (which allows
+ * multiple producers and consumers at the cost of a lock on every call) can be selected instead by defining
+ * USE_RING_BUFFER_FREERTOS. In the lock-free implementation a waiting task blocks until the other side has read or
+ * written something; platforms without FreeRTOS poll once per millisecond.
+ */
 class RingBuffer {
  public:
+  /// Contiguous region inside the ring buffer.
+  struct Span {
+    uint8_t *data;
+    size_t len;
+  };
+
   ~RingBuffer();
 
   /**
    * @brief Reads from the ring buffer, waiting up to a specified number of ticks if necessary.
    *
-   * Available bytes are read into the provided data pointer. If not enough bytes are available,
-   * the function will wait up to `ticks_to_wait` FreeRTOS ticks before reading what is available.
+   * Available bytes are read into the provided data pointer. If the buffer is empty, the function will wait up to
+   * `ticks_to_wait` FreeRTOS ticks for data and then read what is available, which may be less than `len`.
    *
    * @param data Pointer to copy read data into
    * @param len Number of bytes to read
@@ -75,9 +102,42 @@ class RingBuffer {
   /**
    * @brief Resets the ring buffer, discarding all stored data.
    *
-   * @return pdPASS if successful, pdFAIL otherwise
+   * @return True if successful, false otherwise
+   */
+  bool reset();
+
+#ifndef USE_RING_BUFFER_FREERTOS
+  /**
+   * @brief Returns the oldest contiguous block of readable data without copying it.
+   *
+   * Only the consumer may call this. The span is at most `max_len` bytes long and may be shorter than available()
+   * when the data wraps around the end of the storage. The data stays valid until release_read() is called,
+   * as long as the producer does not use the overwriting write().
+   *
+   * @param max_len Maximum number of bytes to return
+   * @return Span of readable bytes, with len 0 if the buffer is empty
    */
-  BaseType_t reset();
+  Span acquire_read(size_t max_len = SIZE_MAX);
+
+  /// @brief Marks the first `len` bytes returned by acquire_read() as consumed.
+  void release_read(size_t len);
+
+  /**
+   * @brief Returns the next contiguous block of free space to be filled in place.
+   *
+   * Only the producer may call this. The span is at most `max_len` bytes long and may be shorter than free()
+   * when the free space wraps around the end of the storage.
+   *
+   * @param max_len Maximum number of bytes to return
+   * @return Span of writable bytes, with len 0 if the buffer is full
+   */
+  Span acquire_write(size_t max_len = SIZE_MAX);
+
+  /// @brief Publishes the first `len` bytes of the span returned by acquire_write() to the consumer.
+  void commit_write(size_t len);
+#endif
+
+  size_t get_capacity() const { return this->size_; }
 
   static std::unique_ptr<RingBuffer> create(size_t len);
 
@@ -87,12 +147,36 @@ class RingBuffer {
   /// @return True if all bytes were successfully discarded, false otherwise
   bool discard_bytes_(size_t discard_bytes);
 
-  RingbufHandle_t handle_{nullptr};
-  StaticRingbuffer_t structure_;
   uint8_t *storage_{nullptr};
   size_t size_{0};
+#ifdef USE_RING_BUFFER_FREERTOS
+  RingbufHandle_t handle_{nullptr};
+  StaticRingbuffer_t structure_;
+#else
+  /// Wakes a task waiting for the other side of the buffer.
+  struct Signal {
+    std::atomic<bool> waiting{false};
+#ifdef USE_ESP32
+    SemaphoreHandle_t handle{nullptr};
+    StaticSemaphore_t structure;
+#endif
+  };
+
+  /// Wait up to `ticks_to_wait` ticks until `ready()` is true, returns its last result.
+  template<typename F> bool wait_(Signal &signal, TickType_t ticks_to_wait, F &&ready);
+  /// Wake the task waiting on `signal`, if any. Called after moving a position.
+  void notify_(Signal &signal);
+  size_t used_(size_t read_pos, size_t write_pos) const;
+  size_t advance_(size_t pos, size_t len) const;
+
+  // Both positions run over [0, 2 * size_) so that a full buffer can be told apart from an empty one.
+  std::atomic<size_t> read_pos_{0};
+  std::atomic<size_t> write_pos_{0};
+  /// Given by the producer for a consumer waiting for data.
+  Signal data_signal_;
+  /// Given by the consumer for a producer waiting for free space.
+  Signal space_signal_;
+#endif
 };
 
 }  // namespace esphome
-
-#endif
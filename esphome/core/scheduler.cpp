@@ -10,14 +10,16 @@ namespace esphome {
 static const char *const TAG = "scheduler";
 
 static const uint32_t MAX_LOGICALLY_DELETED_ITEMS = 10;
+/// Finished items kept for reuse, enough for the timeouts typically in flight at the same time.
+static const size_t MAX_FREE_ITEMS = 8;
 
 // Uncomment to debug scheduler
 // #define ESPHOME_DEBUG_SCHEDULER
 
-// A note on locking: the `lock_` lock protects the `items_` and `to_add_` containers. It must be taken when writing to
-// them (i.e. when adding/removing items, but not when changing items). As items are only deleted from the loop task,
-// iterating over them from the loop task is fine; but iterating from any other context requires the lock to be held to
-// avoid the main thread modifying the list while it is being accessed.
+// A note on locking: the `lock_` lock protects the `items_`, `to_add_` and `free_items_` containers. It must be
+// taken when writing to them (i.e. when adding/removing items, but not when changing items). As items are only
+// deleted from the loop task, iterating over them from the loop task is fine; but iterating from any other context
+// requires the lock to be held to avoid the main thread modifying the list while it is being accessed.
 
 void HOT Scheduler::set_timeout(Component *component, const std::string &name, uint32_t timeout,
                                 std::function<void()> func) {
@@ -31,7 +33,7 @@ void HOT Scheduler::set_timeout(Component *component, const std::string &name, u
 
   ESP_LOGVV(TAG, "set_timeout(name='%s', timeout=%" PRIu32 ")", name.c_str(), timeout);
 
-  auto item = make_unique<SchedulerItem>();
+  auto item = this->new_item_();
   item->component = component;
   item->name = name;
   item->type = SchedulerItem::TIMEOUT;
@@ -62,7 +64,7 @@ void HOT Scheduler::set_interval(Component *component, const std::string &name,
 
   ESP_LOGVV(TAG, "set_interval(name='%s', interval=%" PRIu32 ", offset=%" PRIu32 ")", name.c_str(), interval, offset);
 
-  auto item = make_unique<SchedulerItem>();
+  auto item = this->new_item_();
   item->component = component;
   item->name = name;
   item->type = SchedulerItem::INTERVAL;
@@ -250,6 +252,7 @@ void HOT Scheduler::call() {
       if (item->remove) {
         // We were removed/cancelled in the function call, stop
         to_remove_--;
+        this->recycle_item_(std::move(item));
         continue;
       }
 
@@ -262,6 +265,8 @@ void HOT Scheduler::call() {
             item->last_execution_major++;
         }
         this->push_(std::move(item));
+      } else {
+        this->recycle_item_(std::move(item));
       }
     }
   }
@@ -294,6 +299,24 @@ void HOT Scheduler::cleanup_() {
     }
   }
 }
+std::unique_ptr<Scheduler::SchedulerItem> HOT Scheduler::new_item_() {
+  {
+    LockGuard guard{this->lock_};
+    if (!this->free_items_.empty()) {
+      auto item = std::move(this->free_items_.back());
+      this->free_items_.pop_back();
+      return item;
+    }
+  }
+  return make_unique<SchedulerItem>();
+}
+void HOT Scheduler::recycle_item_(std::unique_ptr<SchedulerItem> item) {
+  // Release what the callback captured now instead of when the item is reused
+  item->callback = nullptr;
+  LockGuard guard{this->lock_};
+  if (this->free_items_.size() < MAX_FREE_ITEMS)
+    this->free_items_.push_back(std::move(item));
+}
 void HOT Scheduler::pop_raw_() {
   std::pop_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
   this->items_.pop_back();
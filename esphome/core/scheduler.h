@@ -67,6 +67,9 @@ class Scheduler {
   void cleanup_();
   void pop_raw_();
   void push_(std::unique_ptr<SchedulerItem> item);
+  /// Take an item from free_items_, or allocate one.
+  std::unique_ptr<SchedulerItem> new_item_();
+  void recycle_item_(std::unique_ptr<SchedulerItem> item);
   bool cancel_item_(Component *component, const std::string &name, SchedulerItem::Type type);
   bool empty_() {
     this->cleanup_();
@@ -76,6 +79,8 @@ class Scheduler {
   Mutex lock_;
   std::vector<std::unique_ptr<SchedulerItem>> items_;
   std::vector<std::unique_ptr<SchedulerItem>> to_add_;
+  /// Finished items for reuse, so that short lived timeouts (e.g. delay actions) do not allocate.
+  std::vector<std::unique_ptr<SchedulerItem>> free_items_;
   uint32_t last_millis_{0};
   uint8_t millis_major_{0};
   uint32_t to_remove_{0};
@@ -571,6 +571,10 @@ def build_message_type(desc):
     encode = []
     dump = []
 
+    id_ = get_opt(desc, pb.id)
+    if id_ is not None:
+        public_content.append(f"static constexpr uint16_t MESSAGE_TYPE = {id_};")
+
     for field in desc.field:
         if field.label == 3:
             ti = RepeatedTypeInfo(field)
@@ -0,0 +1,104 @@
+// Host test for the AD structure iteration in esp32_ble_tracker/ad_structure.h.
+//
+// Walks hand-built advertisement payloads and checks that padding is skipped, that a truncated final structure ends
+// the iteration without reading past the payload, that every service data structure for a UUID is reported and that
+// the TX power level arrives as its signed byte. Run with script/cpp_tests.
+
+#include "esphome/components/esp32_ble_tracker/ad_structure.h"
+#include "test_helpers.h"
+
+#include <vector>
+
+using namespace esphome::esp32_ble_tracker;
+
+static const uint8_t AD_TYPE_FLAG = 0x01;
+static const uint8_t AD_TYPE_NAME_CMPL = 0x09;
+static const uint8_t AD_TYPE_TX_PWR = 0x0A;
+
+struct Structure {
+  uint8_t type;
+  std::vector<uint8_t> data;
+};
+
+static std::vector<Structure> collect(const std::vector<uint8_t> &payload) {
+  std::vector<Structure> structures;
+  for_each_ad_structure(payload.data(), payload.size(), [&](uint8_t type, const uint8_t *data, uint8_t len) {
+    structures.push_back({type, std::vector<uint8_t>(data, data + len)});
+  });
+  return structures;
+}
+
+/// Zero length structures between and after the others are skipped.
+static void test_padding() {
+  const std::vector<uint8_t> payload = {0x00, 0x02, AD_TYPE_FLAG, 0x06, 0x00, 0x00, 0x03, AD_TYPE_NAME_CMPL,
+                                        'a',  'b',  0x00,         0x00, 0x00};
+  auto structures = collect(payload);
+  EXPECT(structures.size() == 2);
+  EXPECT(structures[0].type == AD_TYPE_FLAG && structures[0].data == std::vector<uint8_t>{0x06});
+  EXPECT(structures[1].type == AD_TYPE_NAME_CMPL && structures[1].data == std::vector<uint8_t>({'a', 'b'}));
+
+  // a payload of nothing but padding
+  EXPECT(collect({0x00, 0x00, 0x00, 0x00}).empty());
+}
+
+/// A final structure that claims more bytes than are left is not reported, the ones before it are.
+static void test_truncated() {
+  std::vector<uint8_t> payload = {0x02, AD_TYPE_FLAG, 0x06, 0x05, AD_TYPE_NAME_CMPL, 'a', 'b'};
+  auto structures = collect(payload);
+  EXPECT(structures.size() == 1);
+  EXPECT(structures[0].type == AD_TYPE_FLAG);
+
+  // the bytes after the payload are never looked at: the length says there is one more byte, which is not there
+  payload = {0x02, AD_TYPE_FLAG, 0x06, 0x02, AD_TYPE_TX_PWR};
+  structures = collect(payload);
+  EXPECT(structures.size() == 1);
+
+  // a length byte without a type
+  EXPECT(collect({0x02, AD_TYPE_FLAG, 0x06, 0x03}).size() == 1);
+}
+
+/// Every service data structure for a UUID is reported in payload order, other UUIDs and too short structures are
+/// not.
+static void test_service_data() {
+  const std::vector<uint8_t> payload = {
+      0x05, AD_TYPE_SERVICE_DATA_16, 0x95, 0xFE, 0x01, 0x02,  // 0xFE95
+      0x04, AD_TYPE_SERVICE_DATA_16, 0x1A, 0x18, 0x10,        // 0x181A
+      0x02, AD_TYPE_SERVICE_DATA_16, 0x95,                    // no room for the UUID
+      0x03, AD_TYPE_SERVICE_DATA_16, 0x95, 0xFE,              // 0xFE95 without data
+      0x04, AD_TYPE_SERVICE_DATA_16, 0x95, 0xFE, 0x03,        // 0xFE95
+  };
+  std::vector<std::vector<uint8_t>> entries;
+  for_each_service_data(payload.data(), payload.size(), 0xFE95,
+                        [&](const uint8_t *data, size_t len) { entries.emplace_back(data, data + len); });
+  EXPECT(entries.size() == 3);
+  EXPECT(entries[0] == std::vector<uint8_t>({0x01, 0x02}));
+  EXPECT(entries[1].empty());
+  EXPECT(entries[2] == std::vector<uint8_t>{0x03});
+
+  uint16_t uuids[8];
+  EXPECT(get_service_data_uuids(payload.data(), payload.size(), uuids, 8) == 4);
+  EXPECT(uuids[0] == 0xFE95 && uuids[1] == 0x181A && uuids[2] == 0xFE95 && uuids[3] == 0xFE95);
+  // never more than max
+  EXPECT(get_service_data_uuids(payload.data(), payload.size(), uuids, 2) == 2);
+}
+
+/// The TX power level is a single signed byte, also as the last structure of the payload.
+static void test_tx_power() {
+  const std::vector<uint8_t> payload = {0x02, AD_TYPE_TX_PWR, 0x04, 0x02, AD_TYPE_FLAG, 0x06, 0x02, AD_TYPE_TX_PWR,
+                                        0xF4};
+  std::vector<int8_t> tx_powers;
+  for_each_ad_structure(payload.data(), payload.size(), [&](uint8_t type, const uint8_t *data, uint8_t len) {
+    if (type == AD_TYPE_TX_PWR && len == 1)
+      tx_powers.push_back(int8_t(data[0]));
+  });
+  EXPECT(tx_powers.size() == 2);
+  EXPECT(tx_powers[0] == 4 && tx_powers[1] == -12);
+}
+
+int main() {
+  test_padding();
+  test_truncated();
+  test_service_data();
+  test_tx_power();
+  return test_result();
+}
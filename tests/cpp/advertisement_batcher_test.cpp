@@ -0,0 +1,128 @@
+// sources: esphome/components/bluetooth_proxy/advertisement_batcher.cpp
+
+// Host test for bluetooth_proxy::AdvertisementBatcher.
+//
+// Checks the byte budget, the maximum delay across a millis() wraparound, the merging of identical advertisements
+// and that the counters account for every advertisement added. Uses the budget and delay of the Bluetooth proxy.
+// Run with script/cpp_tests.
+
+#include "esphome/components/bluetooth_proxy/advertisement_batcher.h"
+#include "test_helpers.h"
+
+#include <cstring>
+#include <vector>
+
+using namespace esphome::bluetooth_proxy;
+
+static const size_t BATCH_BYTES = 1024;
+static const uint32_t BATCH_DELAY = 100;
+
+static std::vector<uint8_t> advertisement(uint8_t length, uint8_t seed) {
+  std::vector<uint8_t> data(length);
+  for (uint8_t i = 0; i < length; i++)
+    data[i] = uint8_t(seed + i);
+  return data;
+}
+
+/// 31 byte advertisements are estimated at 51 bytes, so 20 of them fit into the budget and the 21st needs a flush.
+/// A batch that reaches the budget exactly is due without waiting.
+static void test_byte_budget() {
+  AdvertisementBatcher batcher(BATCH_BYTES, BATCH_DELAY);
+  EXPECT(!batcher.is_full_for(62));
+  for (uint8_t i = 0; i < 20; i++) {
+    EXPECT(!batcher.is_full_for(31));
+    const auto data = advertisement(31, i);
+    batcher.add(i, -60, 0, data.data(), data.size(), 0);
+  }
+  EXPECT(batcher.is_full_for(31));
+  // 4 bytes are left, not enough for even an empty advertisement, but the batch is not due yet
+  EXPECT(batcher.is_full_for(0));
+  EXPECT(!batcher.is_due(0));
+  batcher.finish(true);
+  EXPECT(batcher.empty() && !batcher.is_full_for(31));
+
+  // 16 advertisements of 44 bytes are 1024 bytes
+  for (uint8_t i = 0; i < 16; i++) {
+    const auto data = advertisement(44, i);
+    batcher.add(i, -60, 0, data.data(), data.size(), 0);
+  }
+  EXPECT(batcher.is_due(0));
+  EXPECT(batcher.is_full_for(0));
+
+  // an empty batch never needs a flush, even for an advertisement above the budget
+  AdvertisementBatcher tiny(10, BATCH_DELAY);
+  EXPECT(!tiny.is_full_for(31));
+}
+
+/// The delay is measured from the first advertisement of the batch, also when millis() wraps around in between.
+static void test_delay_wraparound() {
+  AdvertisementBatcher batcher(BATCH_BYTES, BATCH_DELAY);
+  const uint32_t start = 0xFFFFFFF0;
+  EXPECT(!batcher.is_due(start));
+  const auto first = advertisement(20, 1);
+  batcher.add(1, -60, 0, first.data(), first.size(), start);
+  EXPECT(!batcher.is_due(start));
+  // later advertisements don't restart the delay
+  const auto second = advertisement(20, 2);
+  batcher.add(2, -60, 0, second.data(), second.size(), 0x00000010);
+  EXPECT(!batcher.is_due(0x00000010));
+  EXPECT(!batcher.is_due(start + BATCH_DELAY - 1));
+  EXPECT(batcher.is_due(start + BATCH_DELAY));
+  EXPECT(batcher.is_due(0x00000100));
+  batcher.finish(true);
+  EXPECT(!batcher.is_due(0x00000100));
+
+  // the next batch starts its own delay
+  batcher.add(1, -60, 0, first.data(), first.size(), 0x00000200);
+  EXPECT(!batcher.is_due(0x00000200 + BATCH_DELAY - 1));
+  EXPECT(batcher.is_due(0x00000200 + BATCH_DELAY));
+}
+
+/// Only the same data from the same address is merged, which refreshes the RSSI. in = out + merged + dropped.
+static void test_merging_and_counters() {
+  AdvertisementBatcher batcher(BATCH_BYTES, BATCH_DELAY);
+  const auto data = advertisement(25, 7);
+  auto other = data;
+  other[24] ^= 0xFF;
+
+  EXPECT(batcher.add(0xA1, -70, 0, data.data(), data.size(), 0));
+  EXPECT(!batcher.add(0xA1, -50, 0, data.data(), data.size(), 1));
+  // different address, different data, shorter data
+  EXPECT(batcher.add(0xA2, -70, 1, data.data(), data.size(), 2));
+  EXPECT(batcher.add(0xA1, -70, 0, other.data(), other.size(), 3));
+  EXPECT(batcher.add(0xA1, -70, 0, data.data(), data.size() - 1, 4));
+  EXPECT(!batcher.add(0xA2, -40, 1, data.data(), data.size(), 5));
+
+  const auto &queued = batcher.get_advertisements();
+  EXPECT(queued.size() == 4);
+  EXPECT(queued[0].address == 0xA1 && queued[0].rssi == -50);
+  EXPECT(queued[1].address == 0xA2 && queued[1].rssi == -40 && queued[1].address_type == 1);
+  EXPECT(queued[2].length == 25 && memcmp(queued[2].data, other.data(), 25) == 0);
+  EXPECT(queued[3].length == 24);
+  EXPECT(batcher.get_advertisements_in() == 6);
+  EXPECT(batcher.get_advertisements_merged() == 2);
+  batcher.finish(true);
+  EXPECT(batcher.get_advertisements_out() == 4);
+
+  // after a flush the same advertisement is queued again instead of merged
+  EXPECT(batcher.add(0xA1, -70, 0, data.data(), data.size(), 10));
+  EXPECT(batcher.add(0xA3, -70, 0, data.data(), data.size(), 11));
+  batcher.finish(false);
+  EXPECT(batcher.get_advertisements_dropped() == 2);
+  EXPECT(batcher.get_advertisements_in() == 8);
+  EXPECT(batcher.get_advertisements_in() == batcher.get_advertisements_out() + batcher.get_advertisements_merged() +
+                                                batcher.get_advertisements_dropped());
+
+  // advertisements with a longer payload are truncated to the storage, and merged by the stored part
+  const auto long_data = advertisement(70, 3);
+  EXPECT(batcher.add(0xB1, -70, 0, long_data.data(), long_data.size(), 20));
+  EXPECT(batcher.get_advertisements()[0].length == sizeof(BatchedAdvertisement::data));
+  EXPECT(!batcher.add(0xB1, -70, 0, long_data.data(), long_data.size(), 21));
+}
+
+int main() {
+  test_byte_budget();
+  test_delay_wraparound();
+  test_merging_and_counters();
+  return test_result();
+}
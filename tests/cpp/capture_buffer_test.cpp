@@ -0,0 +1,219 @@
+// sources: esphome/components/microphone/capture_buffer.cpp esphome/components/microphone/microphone.cpp esphome/core/helpers.cpp
+
+// Host test for the shared capture buffer of microphone::Microphone.
+//
+// A simulated microphone captures a ramp of sample values 10 ms at a time. Checks that readers consuming at
+// different rates and in different span sizes each see the continuous ramp, that a reader falling behind by more
+// than the buffer gets an overrun and resumes with its history without affecting the others, and that readers can be
+// added and removed while capturing. Run with script/cpp_tests.
+
+#include "esphome/components/microphone/microphone.h"
+#include "test_helpers.h"
+
+#include <vector>
+
+using namespace esphome;
+using namespace esphome::microphone;
+
+/// 10 ms at 16 kHz.
+static const size_t CAPTURE_SAMPLES = 160;
+/// Smallest buffer of microphone.cpp, room for one block read from the hardware.
+static const size_t MAX_CAPTURE_SAMPLES = 512;
+
+/// Hardware that has produce() samples buffered, counting up from 0.
+class TestMicrophone : public Microphone {
+ public:
+  void start() override {}
+  void stop() override {}
+  size_t read(int16_t *buf, size_t len) override { return 0; }
+
+  /// Buffer @p samples in the hardware and capture them.
+  size_t produce(size_t samples) {
+    this->pending_ += samples;
+    return this->capture_();
+  }
+  size_t get_capacity() const { return this->capture_buffer_.get_capacity(); }
+  uint16_t next_value() const { return this->next_value_; }
+
+ protected:
+  size_t read_available_(int16_t *buf, size_t max_samples) override {
+    const size_t samples = std::min(max_samples, this->pending_);
+    for (size_t i = 0; i < samples; i++)
+      buf[i] = int16_t(this->next_value_++);
+    this->pending_ -= samples;
+    return samples;
+  }
+
+  size_t pending_{0};
+  uint16_t next_value_{0};
+};
+
+/// Reads from a CaptureReader and checks that the values continue the ramp.
+struct Consumer {
+  explicit Consumer(CaptureReader *reader) : reader(reader) {}
+
+  /// Read up to @p max_samples in spans of at most @p span samples, in place.
+  size_t consume(size_t max_samples, size_t span) {
+    size_t total = 0;
+    while (total < max_samples) {
+      const int16_t *data;
+      const size_t len = this->reader->acquire(&data, std::min(span, max_samples - total));
+      if (len == 0)
+        break;
+      for (size_t i = 0; i < len; i++)
+        this->check(data[i]);
+      this->reader->release(len);
+      total += len;
+    }
+    return total;
+  }
+  /// Read up to @p max_samples through a copy.
+  size_t copy(size_t max_samples) {
+    std::vector<int16_t> data(max_samples);
+    const size_t len = this->reader->read(data.data(), max_samples);
+    for (size_t i = 0; i < len; i++)
+      this->check(data[i]);
+    return len;
+  }
+  void check(int16_t value) {
+    if (this->started)
+      this->continuous &= uint16_t(value) == this->expected;
+    this->started = true;
+    this->expected = uint16_t(value) + 1;
+    this->total++;
+  }
+  /// The next value read is expected to be @p value.
+  void expect_next(uint16_t value) {
+    this->expected = value;
+    this->started = true;
+  }
+
+  CaptureReader *reader;
+  uint16_t expected{0};
+  bool started{false};
+  bool continuous{true};
+  size_t total{0};
+};
+
+/// Three readers at different paces over many wraparounds of the buffer all see every sample in order.
+static void test_different_rates() {
+  TestMicrophone mic;
+  Consumer every_capture(mic.add_reader(0));
+  Consumer every_third(mic.add_reader(1024));
+  Consumer small_spans(mic.add_reader(0));
+  every_capture.expect_next(0);
+  every_third.expect_next(0);
+  small_spans.expect_next(0);
+
+  const int rounds = 1000;
+  for (int round = 0; round < rounds; round++) {
+    EXPECT(mic.produce(CAPTURE_SAMPLES) == CAPTURE_SAMPLES);
+    every_capture.copy(1000);
+    if (round % 3 == 2)
+      every_third.consume(1000, 1000);
+    // in place, in spans that never line up with the captures or the end of the buffer
+    small_spans.consume(1000, 37);
+  }
+  every_third.consume(1000, 1000);
+
+  EXPECT(mic.get_capacity() == 1024 + MAX_CAPTURE_SAMPLES);
+  for (auto *consumer : {&every_capture, &every_third, &small_spans}) {
+    EXPECT(consumer->continuous);
+    EXPECT(consumer->total == rounds * CAPTURE_SAMPLES);
+    EXPECT(consumer->reader->get_overruns() == 0);
+    EXPECT(consumer->reader->available() == 0);
+  }
+}
+
+/// A reader that falls more than the buffer behind gets one overrun and resumes with the most recent history, the
+/// reader keeping up is not affected.
+static void test_overrun() {
+  TestMicrophone mic;
+  Consumer fast(mic.add_reader(0));
+  Consumer slow(mic.add_reader(256));
+  fast.expect_next(0);
+  slow.expect_next(0);
+  mic.produce(CAPTURE_SAMPLES);
+  const size_t capacity = mic.get_capacity();
+  EXPECT(capacity == 256 + MAX_CAPTURE_SAMPLES);
+  slow.consume(100, 100);
+
+  // fill the buffer until the next capture overwrites samples the slow reader has not read
+  size_t produced = CAPTURE_SAMPLES;
+  while (produced - 100 + CAPTURE_SAMPLES <= capacity) {
+    mic.produce(CAPTURE_SAMPLES);
+    produced += CAPTURE_SAMPLES;
+    fast.consume(1000, 64);
+  }
+  EXPECT(slow.reader->available() == produced - 100 && slow.reader->get_overruns() == 0);
+
+  mic.produce(CAPTURE_SAMPLES);
+  produced += CAPTURE_SAMPLES;
+  fast.consume(1000, 64);
+  EXPECT(slow.reader->available() == 256);
+  EXPECT(slow.reader->get_overruns() == 1);
+  // it continues with the last 256 samples
+  slow.expect_next(uint16_t(produced - 256));
+  EXPECT(slow.consume(1000, 1000) == 256);
+  EXPECT(slow.continuous);
+
+  // and from there on without further overruns
+  mic.produce(CAPTURE_SAMPLES);
+  fast.consume(1000, 64);
+  EXPECT(slow.consume(1000, 50) == CAPTURE_SAMPLES);
+  EXPECT(slow.continuous && slow.reader->get_overruns() == 1);
+  EXPECT(fast.continuous && fast.reader->get_overruns() == 0 && fast.total == produced + CAPTURE_SAMPLES);
+}
+
+/// A reader added while capturing starts with the next capture and one removed does not disturb the others. A reader
+/// needing more history grows the buffer, which starts over empty for every reader.
+static void test_add_and_remove() {
+  TestMicrophone mic;
+  Consumer first(mic.add_reader(0));
+  first.expect_next(0);
+  for (int i = 0; i < 10; i++) {
+    mic.produce(CAPTURE_SAMPLES);
+    first.consume(1000, 100);
+  }
+
+  // grows the buffer, the first reader has read everything and loses nothing
+  Consumer second(mic.add_reader(200));
+  EXPECT(second.reader->available() == 0);
+  second.expect_next(mic.next_value());
+  for (int i = 0; i < 10; i++) {
+    mic.produce(CAPTURE_SAMPLES);
+    first.consume(1000, 100);
+    second.copy(1000);
+  }
+  EXPECT(mic.get_capacity() == 200 + MAX_CAPTURE_SAMPLES);
+  EXPECT(second.total == 10 * CAPTURE_SAMPLES);
+
+  mic.remove_reader(second.reader);
+  for (int i = 0; i < 10; i++) {
+    mic.produce(CAPTURE_SAMPLES);
+    first.consume(1000, 100);
+  }
+  EXPECT(first.continuous && first.total == 30 * CAPTURE_SAMPLES);
+  // the buffer is not shrunk
+  EXPECT(mic.get_capacity() == 200 + MAX_CAPTURE_SAMPLES);
+
+  // more history than the buffer holds: unread samples are dropped, both readers continue with the next capture
+  mic.produce(CAPTURE_SAMPLES);
+  Consumer third(mic.add_reader(2000));
+  const uint16_t next = mic.next_value();
+  mic.produce(CAPTURE_SAMPLES);
+  EXPECT(mic.get_capacity() == 2000 + MAX_CAPTURE_SAMPLES);
+  first.expect_next(next);
+  third.expect_next(next);
+  EXPECT(first.consume(1000, 100) == CAPTURE_SAMPLES);
+  EXPECT(third.consume(1000, 100) == CAPTURE_SAMPLES);
+  EXPECT(first.continuous && third.continuous);
+  EXPECT(first.reader->get_overruns() == 0 && third.reader->get_overruns() == 0);
+}
+
+int main() {
+  test_different_rates();
+  test_overrun();
+  test_add_and_remove();
+  return test_result();
+}
@@ -0,0 +1,45 @@
+// Minimal HAL for the host C++ tests, which are linked without the host platform's main(). Runs on the real time
+// unless a test switches to the simulated time.
+
+#include "esphome/core/hal.h"
+#include "test_helpers.h"
+
+#include <chrono>
+#include <thread>
+
+namespace esphome {
+
+static const auto START = std::chrono::steady_clock::now();
+static bool simulated_time = false;    // NOLINT
+static uint32_t simulated_micros = 0;  // NOLINT
+
+uint32_t micros() {
+  if (simulated_time)
+    return simulated_micros;
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - START).count();
+}
+uint32_t millis() { return micros() / 1000; }
+void delay(uint32_t ms) {
+  if (simulated_time) {
+    simulated_micros += ms * 1000;
+    return;
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+void delayMicroseconds(uint32_t us) {
+  if (simulated_time) {
+    simulated_micros += us;
+    return;
+  }
+  std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+void yield() { std::this_thread::yield(); }
+void arch_init() {}
+
+}  // namespace esphome
+
+void use_simulated_time(uint32_t now) {
+  esphome::simulated_time = true;
+  esphome::simulated_micros = now;
+}
+void advance_time(uint32_t us) { esphome::simulated_micros += us; }
@@ -0,0 +1,234 @@
+// sources: esphome/components/i2c/i2c_transaction_queue.cpp esphome/components/i2c/i2c.cpp esphome/core/helpers.cpp
+
+// Host test for the I2CTransactionQueue.
+//
+// Runs batches against a simulated bus with register-file devices and checks that batches are executed whole and
+// in submission order, that a missing device reports a NACK without affecting the other batches, and that the
+// statistics add up over many batches. Run with script/cpp_tests.
+
+#include "esphome/components/i2c/i2c.h"
+#include "esphome/components/i2c/i2c_transaction_queue.h"
+#include "esphome/core/hal.h"
+#include "test_helpers.h"
+
+#include <array>
+#include <cinttypes>
+#include <cstdio>
+#include <map>
+#include <vector>
+
+using namespace esphome;
+using namespace esphome::i2c;
+
+/// Bus with register-file devices: a write sets the register pointer and stores the bytes after it, a read returns
+/// the registers from the pointer on. Addresses without a device are not acknowledged. Every transfer is recorded.
+class SimulatedBus : public I2CBus {
+ public:
+  struct Transfer {
+    uint8_t address;
+    bool read;
+    size_t len;
+  };
+
+  void add_device(uint8_t address) {
+    auto &regs = this->devices_[address].regs;
+    for (size_t i = 0; i < regs.size(); i++)
+      regs[i] = uint8_t(address + i);
+  }
+
+  std::vector<Transfer> log;
+
+ protected:
+  struct Device {
+    std::array<uint8_t, 256> regs;
+    uint8_t pointer{0};
+  };
+
+  ErrorCode readv_impl(uint8_t address, ReadBuffer *buffers, size_t cnt) override {
+    auto it = this->devices_.find(address);
+    if (it == this->devices_.end())
+      return ERROR_NOT_ACKNOWLEDGED;
+    size_t len = 0;
+    for (size_t i = 0; i < cnt; i++) {
+      for (size_t j = 0; j < buffers[i].len; j++)
+        buffers[i].data[j] = it->second.regs[it->second.pointer++];
+      len += buffers[i].len;
+    }
+    this->log.push_back({address, true, len});
+    return ERROR_OK;
+  }
+  ErrorCode writev_impl(uint8_t address, WriteBuffer *buffers, size_t cnt, bool stop) override {
+    auto it = this->devices_.find(address);
+    if (it == this->devices_.end())
+      return ERROR_NOT_ACKNOWLEDGED;
+    size_t len = 0;
+    for (size_t i = 0; i < cnt; i++) {
+      for (size_t j = 0; j < buffers[i].len; j++) {
+        if (len + j == 0) {
+          it->second.pointer = buffers[i].data[j];
+        } else {
+          it->second.regs[it->second.pointer++] = buffers[i].data[j];
+        }
+      }
+      len += buffers[i].len;
+    }
+    this->log.push_back({address, false, len});
+    return ERROR_OK;
+  }
+
+  std::map<uint8_t, Device> devices_;
+};
+
+/// Exposes the per-interval statistics.
+class TestQueue : public I2CTransactionQueue {
+ public:
+  uint32_t get_interval_max_latency() const { return this->interval_max_latency_; }
+  uint32_t get_interval_batches() const { return this->batches_ - this->last_stats_batches_; }
+};
+
+static const uint8_t DEVICES[] = {0x40, 0x41, 0x42};
+static const uint8_t ABSENT = 0x50;
+
+struct Fixture {
+  Fixture() {
+    for (uint8_t address : DEVICES)
+      this->bus.add_device(address);
+    this->queue.set_bus(&this->bus);
+    this->queue.setup();
+  }
+  /// Register read as the blocking read_register() does it: write the register, then a repeated start read.
+  static std::vector<I2CTransfer> read_register(uint8_t reg, size_t len) {
+    std::vector<I2CTransfer> transfers(2);
+    transfers[0].write = {reg};
+    transfers[0].stop = false;
+    transfers[1].read_len = len;
+    return transfers;
+  }
+
+  SimulatedBus bus;
+  TestQueue queue;
+};
+
+/// Callbacks arrive in submission order, the transfers of one batch are not interleaved with others and every read
+/// returns the registers of its own device.
+static void test_ordering() {
+  Fixture f;
+  const int batches = 300;
+  std::vector<int> order;
+  bool data_ok = true;
+  for (int i = 0; i < batches; i++) {
+    const uint8_t address = DEVICES[i % 3];
+    const uint8_t reg = i;
+    I2CDevice device;
+    device.set_i2c_bus(&f.bus);
+    device.set_i2c_address(address);
+    device.submit(Fixture::read_register(reg, 3),
+                  [&order, &data_ok, i, address, reg](ErrorCode err, const std::vector<uint8_t> &data) {
+                    order.push_back(i);
+                    data_ok &= err == ERROR_OK && data.size() == 3 && data[0] == uint8_t(address + reg) &&
+                               data[2] == uint8_t(address + reg + 2);
+                  });
+  }
+  // nothing is executed before the queue runs
+  EXPECT(f.bus.log.empty() && order.empty());
+  f.queue.loop();
+
+  EXPECT(order.size() == batches);
+  bool in_order = true;
+  for (size_t i = 0; i < order.size(); i++)
+    in_order &= order[i] == int(i);
+  EXPECT(in_order);
+  EXPECT(data_ok);
+  EXPECT(f.bus.log.size() == 2 * batches);
+  bool whole = true;
+  for (size_t i = 0; i + 1 < f.bus.log.size(); i += 2) {
+    const uint8_t address = DEVICES[(i / 2) % 3];
+    whole &= f.bus.log[i].address == address && !f.bus.log[i].read && f.bus.log[i + 1].address == address &&
+             f.bus.log[i + 1].read && f.bus.log[i + 1].len == 3;
+  }
+  EXPECT(whole);
+}
+
+/// A batch for a missing device stops at the NACK, the batches around it complete normally.
+static void test_nack() {
+  Fixture f;
+  std::vector<ErrorCode> errors;
+  for (uint8_t address : {DEVICES[0], ABSENT, DEVICES[1]}) {
+    I2CDevice device;
+    device.set_i2c_bus(&f.bus);
+    device.set_i2c_address(address);
+    device.submit(Fixture::read_register(0x10, 2),
+                  [&errors](ErrorCode err, const std::vector<uint8_t> &data) { errors.push_back(err); });
+  }
+  f.queue.loop();
+  EXPECT(errors.size() == 3);
+  EXPECT(errors[0] == ERROR_OK && errors[1] == ERROR_NOT_ACKNOWLEDGED && errors[2] == ERROR_OK);
+  // the read of the failed batch was not attempted
+  EXPECT(f.bus.log.size() == 4);
+}
+
+/// Without a queue submit() executes the batch before it returns.
+static void test_without_queue() {
+  SimulatedBus bus;
+  bus.add_device(DEVICES[0]);
+  I2CDevice device;
+  device.set_i2c_bus(&bus);
+  device.set_i2c_address(DEVICES[0]);
+  bool called = false;
+  device.submit(Fixture::read_register(0x20, 1), [&called](ErrorCode err, const std::vector<uint8_t> &data) {
+    called = err == ERROR_OK && data.size() == 1 && data[0] == uint8_t(DEVICES[0] + 0x20);
+  });
+  EXPECT(called);
+}
+
+/// Many batches in bursts: the statistics count every batch, the busy time fits into the elapsed time, and the
+/// per-interval values start over after each statistics log.
+static void test_throughput() {
+  Fixture f;
+  const int bursts = 1000;
+  const int burst = 100;
+  int completed = 0;
+  const uint32_t start = micros();
+  for (int i = 0; i < bursts; i++) {
+    I2CDevice device;
+    device.set_i2c_bus(&f.bus);
+    for (int j = 0; j < burst; j++) {
+      device.set_i2c_address(DEVICES[j % 3]);
+      device.submit(Fixture::read_register(j, 2), [&completed](ErrorCode err, const std::vector<uint8_t> &data) {
+        completed += err == ERROR_OK;
+      });
+    }
+    f.queue.loop();
+  }
+  const uint32_t elapsed = micros() - start;
+
+  EXPECT(completed == bursts * burst);
+  EXPECT(f.queue.get_batches() == uint32_t(bursts * burst));
+  EXPECT(f.queue.get_busy_time() <= elapsed);
+  EXPECT(f.queue.get_average_latency() <= f.queue.get_max_latency());
+  EXPECT(f.queue.get_interval_batches() == uint32_t(bursts * burst));
+  EXPECT(f.queue.get_interval_max_latency() == f.queue.get_max_latency());
+  printf("%d batches in %" PRIu32 " us\n", completed, elapsed);
+
+  EXPECT(scheduler.run(&f.queue, "stats"));
+  EXPECT(f.queue.get_interval_batches() == 0);
+  EXPECT(f.queue.get_interval_max_latency() == 0);
+  // the totals since boot are kept
+  EXPECT(f.queue.get_batches() == uint32_t(bursts * burst));
+
+  I2CDevice device;
+  device.set_i2c_bus(&f.bus);
+  device.set_i2c_address(DEVICES[0]);
+  device.submit(Fixture::read_register(0, 1), [](ErrorCode err, const std::vector<uint8_t> &data) {});
+  f.queue.loop();
+  EXPECT(f.queue.get_interval_batches() == 1);
+  EXPECT(f.queue.get_interval_max_latency() <= f.queue.get_max_latency());
+}
+
+int main() {
+  test_ordering();
+  test_nack();
+  test_without_queue();
+  test_throughput();
+  return test_result();
+}
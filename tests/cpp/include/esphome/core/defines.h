@@ -0,0 +1,15 @@
+#pragma once
+
+// Feature flags of the host C++ tests. Found before esphome/core/defines.h, which enables every feature for the
+// static analyzers, including ones that need libraries the tests are built without. Like the defines.h generated
+// for a build, it only enables what the tests use.
+
+#include "esphome/core/macros.h"
+
+#define ESPHOME_BOARD "host"
+#define ESPHOME_VARIANT "host"
+
+#define USE_BINARY_SENSOR
+#define USE_NETWORK
+#define USE_SENSOR
+#define USE_SOCKET_IMPL_BSD_SOCKETS
@@ -0,0 +1,136 @@
+// Host test for ISRQueue.
+//
+// Checks the capacity, the drop count and the wraparound of the counters on one thread, then lets a producer thread
+// stand in for the interrupt handler while the consumer stalls now and then: every event is either received or
+// counted as dropped, and the received events keep their order. Run with script/cpp_tests.
+
+#include "esphome/core/isr_queue.h"
+#include "test_helpers.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+using namespace esphome;
+
+/// Starts the counters just below their wraparound.
+template<typename T, size_t N> class WrappingQueue : public ISRQueue<T, N> {
+ public:
+  explicit WrappingQueue(uint32_t start) {
+    this->head_ = start;
+    this->tail_ = start;
+  }
+};
+
+static EdgeEvent event(uint32_t sequence) { return {sequence, uint8_t(sequence % 4), (sequence & 1) != 0}; }
+
+/// A full queue drops and counts the events pushed into it, take_dropped() reports each drop once.
+static void test_capacity_and_drops() {
+  ISRQueue<EdgeEvent, 8> queue;
+  EXPECT(queue.empty() && queue.capacity() == 8);
+  for (uint32_t i = 0; i < 8; i++)
+    EXPECT(queue.push(event(i)));
+  EXPECT(queue.size() == 8);
+  EXPECT(!queue.push(event(8)));
+  EXPECT(!queue.push(event(9)));
+  EXPECT(queue.take_dropped() == 2);
+  EXPECT(queue.take_dropped() == 0);
+
+  EdgeEvent out{};
+  EXPECT(queue.pop(out) && out.timestamp == 0 && out.pin == 0 && !out.level);
+  // room for one again
+  EXPECT(queue.push(event(10)));
+  EXPECT(!queue.push(event(11)));
+  EXPECT(queue.take_dropped() == 1);
+  uint32_t expected = 1;
+  bool in_order = true;
+  while (queue.pop(out)) {
+    in_order &= out.timestamp == expected;
+    expected = expected == 7 ? 10 : expected + 1;
+  }
+  EXPECT(in_order && expected == 11);
+  EXPECT(queue.empty() && !queue.pop(out));
+}
+
+/// size(), full and empty stay correct while the counters wrap around.
+static void test_counter_wraparound() {
+  WrappingQueue<EdgeEvent, 4> queue(UINT32_MAX - 2);
+  bool ok = true;
+  uint32_t next_out = 0;
+  EdgeEvent out{};
+  for (uint32_t i = 0; i < 20; i++) {
+    ok &= queue.push(event(i));
+    if (i % 2 == 1) {
+      ok &= queue.size() == 2 && queue.pop(out) && out.timestamp == next_out++;
+      ok &= queue.pop(out) && out.timestamp == next_out++;
+    }
+  }
+  EXPECT(ok);
+  for (uint32_t i = 0; i < 4; i++)
+    EXPECT(queue.push(event(100 + i)));
+  EXPECT(!queue.push(event(104)) && queue.size() == 4);
+  EXPECT(queue.take_dropped() == 1);
+}
+
+/// A producer thread pushes numbered events in bursts while the consumer pops up to 32 at a time and stalls every
+/// now and then. Received plus dropped events add up to the pushed ones, the received ones arrive in order and the
+/// drops the producer saw are the ones reported.
+static void test_stalled_consumer() {
+  static ISRQueue<EdgeEvent, 64> queue;
+  const uint32_t injected = 50000;
+  std::atomic<bool> done{false};
+  uint32_t rejected = 0;
+  std::thread producer([&]() {
+    for (uint32_t i = 0; i < injected; i++) {
+      if (!queue.push(event(i)))
+        rejected++;
+      // bursts of interrupts, also giving the consumer a chance on a single core
+      if (i % 16 == 15)
+        std::this_thread::sleep_for(std::chrono::microseconds(20));
+    }
+    done = true;
+  });
+
+  uint32_t received = 0;
+  uint32_t dropped = 0;
+  uint32_t gaps = 0;
+  int64_t last = -1;
+  bool in_order = true;
+  bool intact = true;
+  for (uint32_t round = 0; !done || !queue.empty(); round++) {
+    EdgeEvent out{};
+    for (int i = 0; i < 32 && queue.pop(out); i++) {
+      in_order &= int64_t(out.timestamp) > last;
+      gaps += out.timestamp - uint32_t(last + 1);
+      intact &= out.pin == out.timestamp % 4 && out.level == ((out.timestamp & 1) != 0);
+      last = out.timestamp;
+      received++;
+    }
+    dropped += queue.take_dropped();
+    if (round % 64 == 0) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+  dropped += queue.take_dropped();
+  // events dropped after the last received one
+  gaps += injected - uint32_t(last + 1);
+
+  printf("%u received, %u dropped\n", (unsigned) received, (unsigned) dropped);
+  EXPECT(received + dropped == injected);
+  EXPECT(dropped == rejected);
+  EXPECT(dropped == gaps);
+  EXPECT(dropped > 0);
+  EXPECT(in_order);
+  EXPECT(intact);
+}
+
+int main() {
+  test_capacity_and_drops();
+  test_counter_wraparound();
+  test_stalled_consumer();
+  return test_result();
+}
@@ -0,0 +1,139 @@
+// sources: esphome/components/modbus_controller/modbus_controller.cpp esphome/components/modbus/modbus.cpp esphome/components/uart/uart_component.cpp esphome/core/helpers.cpp
+
+// Host test for the register ranges and the command queue of modbus_controller::ModbusController.
+//
+// Checks that gaps between sensors are only bridged while the range stays within the 125 registers a single read
+// request may ask for, also without max_registers_per_request, and that the sensors' offsets in the response stay
+// correct up to that limit, and that queued reads are only merged when neither has its own handler. Run with
+// script/cpp_tests.
+
+#include "esphome/components/modbus_controller/modbus_controller.h"
+#include "test_helpers.h"
+
+#include <list>
+#include <memory>
+#include <vector>
+
+using namespace esphome;
+using namespace esphome::modbus_controller;
+
+class TestSensor : public SensorItem {
+ public:
+  TestSensor(uint16_t start_address, uint8_t register_count) {
+    this->register_type = ModbusRegisterType::HOLDING;
+    this->sensor_value_type = SensorValueType::U_WORD;
+    this->start_address = start_address;
+    this->register_count = register_count;
+  }
+  void parse_and_publish(const std::vector<uint8_t> &data) override {}
+};
+
+/// Exposes the register ranges.
+class TestController : public ModbusController {
+ public:
+  TestController() {
+    this->bus_.set_role(modbus::ModbusRole::CLIENT);
+    this->set_parent(&this->bus_);
+    this->set_max_register_gap(124);
+  }
+  size_t create_ranges() { return this->create_register_ranges_(); }
+  const std::vector<RegisterRange> &ranges() const { return this->register_ranges_; }
+  const std::list<std::unique_ptr<ModbusCommandItem>> &queue() const { return this->command_queue_; }
+
+ protected:
+  modbus::Modbus bus_;
+};
+
+/// A gap that would take the range to exactly 125 registers is bridged, the offset of the sensor after it accounts
+/// for the whole gap.
+static void test_bridge_up_to_limit() {
+  TestController controller;
+  TestSensor first(0, 100);
+  TestSensor second(120, 5);
+  controller.add_sensor_item(&first);
+  controller.add_sensor_item(&second);
+  EXPECT(controller.create_ranges() == 1);
+  EXPECT(controller.ranges()[0].register_count == 125);
+  EXPECT(controller.ranges()[0].gap_registers == 20);
+  EXPECT(second.start_address == 0);
+  EXPECT(second.offset == 240);
+}
+
+/// One register more and the gap is not bridged, even though it is within max_register_gap and there is no
+/// max_registers_per_request.
+static void test_no_bridge_beyond_limit() {
+  TestController controller;
+  TestSensor first(0, 120);
+  TestSensor second(130, 1);
+  controller.add_sensor_item(&first);
+  controller.add_sensor_item(&second);
+  EXPECT(controller.create_ranges() == 2);
+  EXPECT(controller.ranges()[0].register_count == 120);
+  EXPECT(controller.ranges()[0].gap_registers == 0);
+  EXPECT(controller.ranges()[1].start_address == 130);
+  EXPECT(second.start_address == 130);
+  EXPECT(second.offset == 0);
+}
+
+/// Several bridged gaps add up and stop at the limit as well.
+static void test_chain_of_gaps() {
+  TestController controller;
+  std::vector<TestSensor> sensors;
+  sensors.reserve(10);
+  for (uint16_t i = 0; i < 10; i++)
+    sensors.emplace_back(i * 20, 2);
+  for (auto &sensor : sensors)
+    controller.add_sensor_item(&sensor);
+  controller.create_ranges();
+  bool within_limit = true;
+  for (auto &range : controller.ranges())
+    within_limit &= range.register_count <= 125;
+  EXPECT(within_limit);
+  EXPECT(controller.ranges().size() == 2);
+  // sensor 6 ends at register 122, sensor 7 would end at 142
+  EXPECT(controller.ranges()[0].register_count == 122);
+  EXPECT(sensors[6].offset == 240);
+  EXPECT(sensors[7].start_address == 140 && sensors[7].offset == 0);
+}
+
+/// Identical reads for the sensors are merged, a read with its own handler is never merged away.
+static void test_read_deduplication() {
+  TestController controller;
+  auto periodic = ModbusCommandItem::create_read_command(&controller, ModbusRegisterType::HOLDING, 10, 2);
+  periodic.priority = ModbusCommandPriority::PERIODIC_READ;
+  controller.queue_command(periodic);
+  controller.queue_command(periodic);
+  EXPECT(controller.queue().size() == 1);
+
+  int handled = 0;
+  auto custom = ModbusCommandItem::create_read_command(
+      &controller, ModbusRegisterType::HOLDING, 10, 2,
+      [&handled](ModbusRegisterType register_type, uint16_t start_address, const std::vector<uint8_t> &data) {
+        handled++;
+      });
+  controller.queue_command(custom);
+  controller.queue_command(custom);
+  // both custom reads are queued ahead of the periodic read, which still feeds the sensors
+  EXPECT(controller.queue().size() == 3);
+  EXPECT(!controller.queue().front()->default_handler);
+  EXPECT(controller.queue().back()->default_handler &&
+         controller.queue().back()->priority == ModbusCommandPriority::PERIODIC_READ);
+  for (auto &item : controller.queue())
+    item->on_data_func(item->register_type, item->register_address, {});
+  EXPECT(handled == 2);
+
+  // an on-demand read for the sensors replaces the queued periodic one
+  auto on_demand = ModbusCommandItem::create_read_command(&controller, ModbusRegisterType::HOLDING, 10, 2);
+  controller.queue_command(on_demand);
+  EXPECT(controller.queue().size() == 3);
+  EXPECT(controller.queue().back()->default_handler &&
+         controller.queue().back()->priority == ModbusCommandPriority::READ);
+}
+
+int main() {
+  test_bridge_up_to_limit();
+  test_no_bridge_beyond_limit();
+  test_chain_of_gaps();
+  test_read_deduplication();
+  return test_result();
+}
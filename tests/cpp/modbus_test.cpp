@@ -0,0 +1,196 @@
+// sources: esphome/components/modbus/modbus.cpp esphome/components/uart/uart_component.cpp esphome/core/helpers.cpp
+
+// Host fuzz test for the modbus::Modbus frame receiver.
+//
+// Feeds responses through a fake UART in random chunks, with a slow loop that polls idle only once between chunks,
+// with noise before the frames and with real inter-frame gaps, and checks that every frame arrives intact. Run with
+// script/cpp_tests.
+
+#include "esphome/components/modbus/modbus.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "test_helpers.h"
+
+#include <deque>
+#include <random>
+#include <vector>
+
+using namespace esphome;
+
+/// UART whose receive buffer is filled by the test.
+class FakeUART : public uart::UARTComponent {
+ public:
+  void write_array(const uint8_t *data, size_t len) override {}
+  bool peek_byte(uint8_t *data) override {
+    if (this->rx.empty())
+      return false;
+    *data = this->rx.front();
+    return true;
+  }
+  bool read_array(uint8_t *data, size_t len) override {
+    if (this->rx.size() < len)
+      return false;
+    for (size_t i = 0; i < len; i++) {
+      data[i] = this->rx.front();
+      this->rx.pop_front();
+    }
+    return true;
+  }
+  int available() override { return this->rx.size(); }
+  void flush() override {}
+
+  std::deque<uint8_t> rx;
+
+ protected:
+  void check_logger_conflict() override {}
+};
+
+class RecordingDevice : public modbus::ModbusDevice {
+ public:
+  void on_modbus_data(const std::vector<uint8_t> &data) override { this->frames.push_back(data); }
+  std::vector<std::vector<uint8_t>> frames;
+};
+
+static const uint8_t ADDRESS = 0x11;
+
+/// Read holding registers response carrying \p data.
+static std::vector<uint8_t> make_frame(const std::vector<uint8_t> &data) {
+  std::vector<uint8_t> frame{ADDRESS, 0x03, uint8_t(data.size())};
+  frame.insert(frame.end(), data.begin(), data.end());
+  const uint16_t crc = crc16(frame.data(), frame.size());
+  frame.push_back(crc >> 0);
+  frame.push_back(crc >> 8);
+  return frame;
+}
+
+struct Fixture {
+  Fixture() {
+    this->uart.set_baud_rate(115200);
+    this->uart.set_data_bits(8);
+    this->uart.set_stop_bits(1);
+    this->uart.set_parity(uart::UART_CONFIG_PARITY_NONE);
+    this->bus.set_uart_parent(&this->uart);
+    this->bus.set_role(modbus::ModbusRole::CLIENT);
+    this->bus.set_disable_crc(false);
+    this->device.set_parent(&this->bus);
+    this->device.set_address(ADDRESS);
+    this->bus.register_device(&this->device);
+    this->bus.setup();
+  }
+
+  /// Deliver \p bytes in random chunks, polling idle once in between like a loop that is slower than the driver.
+  void deliver(const std::vector<uint8_t> &bytes, std::mt19937 &rng) {
+    size_t pos = 0;
+    while (pos < bytes.size()) {
+      const size_t chunk = std::min<size_t>(bytes.size() - pos, 1 + rng() % 40);
+      this->uart.rx.insert(this->uart.rx.end(), bytes.begin() + pos, bytes.begin() + pos + chunk);
+      pos += chunk;
+      this->bus.loop();
+      delayMicroseconds(rng() % 4000);
+      this->bus.loop();
+    }
+  }
+
+  /// Keep the bus silent for longer than the inter-frame gap while the loop polls.
+  void gap() {
+    for (int i = 0; i < 3; i++) {
+      this->bus.loop();
+      delayMicroseconds(this->bus.get_inter_frame_us());
+    }
+  }
+
+  FakeUART uart;
+  modbus::Modbus bus;
+  RecordingDevice device;
+};
+
+static std::vector<uint8_t> random_bytes(std::mt19937 &rng, size_t len) {
+  std::vector<uint8_t> bytes(len);
+  for (auto &byte : bytes)
+    byte = rng();
+  return bytes;
+}
+
+/// Long frames split by a slow loop must not be cut at the chunk boundaries.
+static void test_chunked_frames(std::mt19937 &rng) {
+  Fixture f;
+  std::vector<std::vector<uint8_t>> sent;
+  for (int round = 0; round < 50; round++) {
+    const auto data = random_bytes(rng, 2 * (1 + rng() % 125));
+    sent.push_back(data);
+    f.deliver(make_frame(data), rng);
+  }
+  EXPECT(f.device.frames == sent);
+}
+
+/// Noise in front of a frame is skipped, whether or not it is followed by a gap.
+static void test_noise(std::mt19937 &rng) {
+  Fixture f;
+  int received = 0;
+  for (int round = 0; round < 200; round++) {
+    const auto data = random_bytes(rng, 2 * (1 + rng() % 20));
+    auto bytes = random_bytes(rng, rng() % 12);
+    const bool with_gap = rng() % 2;
+    if (with_gap) {
+      f.deliver(bytes, rng);
+      f.gap();
+      bytes.clear();
+    }
+    const auto frame = make_frame(data);
+    bytes.insert(bytes.end(), frame.begin(), frame.end());
+    f.deliver(bytes, rng);
+    f.gap();
+    // flush whatever the noise left behind with a frame that has to arrive too
+    f.deliver(make_frame({0x12, 0x34}), rng);
+    f.gap();
+    for (auto &frame : f.device.frames) {
+      if (frame == data)
+        received++;
+    }
+    f.device.frames.clear();
+  }
+  EXPECT(received >= 200);
+}
+
+/// Random bytes must never crash the receiver and it has to be back in sync after a gap.
+static void test_garbage(std::mt19937 &rng) {
+  Fixture f;
+  for (int round = 0; round < 200; round++) {
+    f.deliver(random_bytes(rng, rng() % 600), rng);
+    f.gap();
+    f.device.frames.clear();
+    const auto data = random_bytes(rng, 4);
+    f.deliver(make_frame(data), rng);
+    EXPECT(!f.device.frames.empty() && f.device.frames.back() == data);
+    f.gap();
+  }
+}
+
+/// A user-defined function code has no length, so noise that starts like one fills the whole buffer. The byte that
+/// overflows it must not be lost, it may start the next frame.
+static void test_overflow(std::mt19937 &rng) {
+  Fixture f;
+  for (int round = 0; round < 20; round++) {
+    auto bytes = random_bytes(rng, modbus::MAX_FRAME_SIZE);
+    bytes[0] = ADDRESS;
+    bytes[1] = 0x41;
+    const auto data = random_bytes(rng, 6);
+    const auto frame = make_frame(data);
+    bytes.insert(bytes.end(), frame.begin(), frame.end());
+    f.deliver(bytes, rng);
+    // the noise swallows the frame as far as the receiver can tell until the frame has ended, so let it time out
+    delay(60);
+    f.bus.loop();
+    EXPECT(!f.device.frames.empty() && f.device.frames.back() == data);
+    f.device.frames.clear();
+  }
+}
+
+int main() {
+  std::mt19937 rng(27);
+  test_chunked_frames(rng);
+  test_noise(rng);
+  test_garbage(rng);
+  test_overflow(rng);
+  return test_result();
+}
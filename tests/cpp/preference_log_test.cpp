@@ -0,0 +1,145 @@
+// sources: esphome/components/preferences/preference_log.cpp esphome/components/host/flash.cpp esphome/core/helpers.cpp
+
+// Host test for preferences::PreferenceLog on top of the simulated host::HostFlash.
+//
+// Checks that values survive reopening, that erases are spread over all sectors and that a power loss at any
+// byte of a write or compaction keeps either the old or the new value of every key. Run with script/cpp_tests.
+
+#include "esphome/components/host/flash.h"
+#include "esphome/components/preferences/preference_log.h"
+#include "test_helpers.h"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using esphome::host::HostFlash;
+using esphome::preferences::PreferenceLog;
+
+static const size_t SECTOR_SIZE = 256;
+static const size_t SECTOR_COUNT = 4;
+static const uint32_t KEY_COUNT = 6;
+static const size_t VALUE_SIZE = 16;
+
+/// Key 1 is written every round, key 2 every second round and so on, the last key only in the first round. So the
+/// oldest sector still holds live records when it is reclaimed.
+static uint32_t last_written(uint32_t key, uint32_t round) { return key == KEY_COUNT ? 0 : round - round % key; }
+static bool is_written(uint32_t key, uint32_t round) { return last_written(key, round) == round; }
+
+/// The value of \p key after round \p round.
+static void make_value(uint32_t key, uint32_t round, uint8_t *value) {
+  round = last_written(key, round);
+  for (size_t i = 0; i < VALUE_SIZE; i++)
+    value[i] = uint8_t(key * 31 + round * 7 + i);
+}
+
+/// Write round \p round, returns false as soon as a write fails.
+static bool write_round(PreferenceLog &log, uint32_t round) {
+  uint8_t value[VALUE_SIZE];
+  for (uint32_t key = 1; key <= KEY_COUNT; key++) {
+    if (!is_written(key, round))
+      continue;
+    make_value(key, round, value);
+    if (!log.write(key, value, sizeof(value)))
+      return false;
+  }
+  return true;
+}
+
+static void test_reopen_and_wear() {
+  HostFlash flash(SECTOR_SIZE, SECTOR_COUNT);
+  {
+    PreferenceLog log(&flash);
+    EXPECT(log.open());
+    for (uint32_t round = 0; round < 600; round++)
+      EXPECT(write_round(log, round));
+    // Unchanged values are not written again.
+    const uint32_t written = log.get_records_written();
+    EXPECT(write_round(log, 599));
+    EXPECT(log.get_records_written() == written);
+  }
+
+  PreferenceLog log(&flash);
+  EXPECT(log.open());
+  EXPECT(log.get_entry_count() == KEY_COUNT);
+  uint8_t value[VALUE_SIZE], expected[VALUE_SIZE];
+  for (uint32_t key = 1; key <= KEY_COUNT; key++) {
+    make_value(key, 599, expected);
+    EXPECT(log.load(key, value, sizeof(value)));
+    EXPECT(memcmp(value, expected, sizeof(value)) == 0);
+  }
+
+  uint32_t min_erases = flash.get_max_erases();
+  for (size_t sector = 0; sector < SECTOR_COUNT; sector++)
+    min_erases = std::min(min_erases, flash.get_erase_count(sector));
+  EXPECT(flash.get_max_erases() - min_erases <= 1);
+  printf("wear: %u erases, %u..%u per sector\n", flash.get_total_erases(), min_erases, flash.get_max_erases());
+}
+
+static void test_power_loss() {
+  // Enough rounds that the interrupted writes hit appends, sector starts and compactions.
+  const uint32_t rounds = 40;
+  size_t budget_limit = 0;
+  {
+    HostFlash flash(SECTOR_SIZE, SECTOR_COUNT);
+    PreferenceLog log(&flash);
+    log.open();
+    for (uint32_t round = 0; round < rounds; round++)
+      write_round(log, round);
+    budget_limit = flash.get_bytes_written() + flash.get_total_erases() * SECTOR_SIZE;
+  }
+
+  // Power is lost a second time while recovering, with these budgets (-1: no second power loss).
+  const int32_t recovery_budgets[] = {-1, 0, 12, 40, 120, 256, 264, 280, 300};
+  uint32_t checked = 0;
+  for (size_t budget = 0; budget < budget_limit; budget += 4) {
+    HostFlash crashed(SECTOR_SIZE, SECTOR_COUNT);
+    crashed.set_write_budget(budget);
+    uint32_t completed = 0;
+    {
+      PreferenceLog log(&crashed);
+      log.open();
+      for (; completed < rounds; completed++) {
+        if (!write_round(log, completed))
+          break;
+      }
+    }
+
+    for (int32_t recovery_budget : recovery_budgets) {
+      HostFlash flash = crashed;
+      flash.set_write_budget(recovery_budget);
+      {
+        PreferenceLog log(&flash);
+        log.open();
+      }
+      flash.set_write_budget(-1);
+
+      // Every key holds its value of the last completed round or of the interrupted one.
+      PreferenceLog log(&flash);
+      EXPECT(log.open());
+      uint8_t value[VALUE_SIZE], previous[VALUE_SIZE], next[VALUE_SIZE];
+      for (uint32_t key = 1; key <= KEY_COUNT && completed != 0; key++) {
+        make_value(key, completed - 1, previous);
+        make_value(key, completed, next);
+        const bool loaded = log.load(key, value, sizeof(value));
+        if (!loaded || (memcmp(value, previous, sizeof(value)) != 0 && memcmp(value, next, sizeof(value)) != 0)) {
+          printf("budget %zu/%d: key %u lost its value after %u rounds\n", budget, recovery_budget, key, completed);
+          failures++;
+        }
+      }
+      // The log keeps working after the recovery.
+      if (!write_round(log, rounds)) {
+        printf("budget %zu/%d: write failed after recovery\n", budget, recovery_budget);
+        failures++;
+      }
+      checked++;
+    }
+  }
+  printf("power loss: %u interruption points checked\n", checked);
+}
+
+int main() {
+  test_reopen_and_wear();
+  test_power_loss();
+  return test_result();
+}
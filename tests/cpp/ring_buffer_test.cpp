@@ -0,0 +1,247 @@
+// sources: esphome/core/ring_buffer.cpp esphome/core/helpers.cpp
+
+// Host test for the lock-free RingBuffer.
+//
+// Checks that read() returns what is available instead of waiting for the full length, that the waiting calls
+// time out, that the zero-copy spans wrap around the end of the storage and can be released in parts, and that a
+// producer and a consumer thread transfer a stream without losing or reordering bytes, through the copying and
+// through the zero-copy calls. Prints the throughput of both. Run with script/cpp_tests.
+
+#include "esphome/core/ring_buffer.h"
+#include "test_helpers.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+
+using esphome::RingBuffer;
+
+static void test_partial_read() {
+  auto rb = RingBuffer::create(16);
+  const uint8_t in[4] = {1, 2, 3, 4};
+  EXPECT(rb->write_without_replacement(in, sizeof(in)) == 4);
+  uint8_t out[16];
+  // only 4 bytes are there, so they are returned right away even though 10 ticks could be waited for more
+  EXPECT(rb->read(out, sizeof(out), 10) == 4);
+  EXPECT(out[0] == 1 && out[3] == 4);
+  EXPECT(rb->read(out, sizeof(out), 5) == 0);
+}
+
+static void test_write_timeout() {
+  auto rb = RingBuffer::create(8);
+  const uint8_t in[6] = {};
+  EXPECT(rb->write_without_replacement(in, sizeof(in)) == 6);
+  // does not fit completely, so after waiting only what fits is written
+  EXPECT(rb->write_without_replacement(in, sizeof(in), 5) == 2);
+  EXPECT(rb->free() == 0);
+}
+
+static void test_overwrite() {
+  auto rb = RingBuffer::create(8);
+  for (uint8_t i = 0; i < 12; i++)
+    rb->write(&i, 1);
+  uint8_t out[8];
+  EXPECT(rb->read(out, sizeof(out)) == 8);
+  EXPECT(out[0] == 4 && out[7] == 11);
+}
+
+static void test_threads() {
+  static const size_t TOTAL = 1 << 20;
+  auto rb = RingBuffer::create(257);
+  std::thread producer([&rb]() {
+    std::vector<uint8_t> chunk(100);
+    size_t sent = 0;
+    while (sent < TOTAL) {
+      const size_t len = std::min(chunk.size(), TOTAL - sent);
+      for (size_t i = 0; i < len; i++)
+        chunk[i] = uint8_t((sent + i) * 7);
+      sent += rb->write_without_replacement(chunk.data(), len, 100);
+    }
+  });
+  std::vector<uint8_t> buffer(64);
+  size_t received = 0;
+  bool in_order = true;
+  while (received < TOTAL) {
+    const size_t len = rb->read(buffer.data(), buffer.size(), 100);
+    for (size_t i = 0; i < len; i++)
+      in_order &= buffer[i] == uint8_t((received + i) * 7);
+    received += len;
+  }
+  producer.join();
+  EXPECT(in_order);
+  EXPECT(rb->available() == 0);
+}
+
+/// The spans stop at the end of the storage, the rest follows in the next span from its start.
+static void test_zero_copy_wraparound() {
+  auto rb = RingBuffer::create(10);
+  auto span = rb->acquire_write();
+  EXPECT(span.len == 10);
+  for (size_t i = 0; i < 7; i++)
+    span.data[i] = i;
+  rb->commit_write(7);
+  EXPECT(rb->available() == 7);
+
+  span = rb->acquire_read();
+  EXPECT(span.len == 7 && span.data[0] == 0);
+  rb->release_read(5);
+  EXPECT(rb->available() == 2 && rb->free() == 8);
+
+  // 3 bytes up to the end of the storage, then 5 from its start
+  span = rb->acquire_write();
+  EXPECT(span.len == 3);
+  for (size_t i = 0; i < span.len; i++)
+    span.data[i] = 7 + i;
+  rb->commit_write(span.len);
+  span = rb->acquire_write(4);
+  EXPECT(span.len == 4);
+  for (size_t i = 0; i < span.len; i++)
+    span.data[i] = 10 + i;
+  rb->commit_write(span.len);
+  EXPECT(rb->available() == 9 && rb->free() == 1);
+
+  // the readable data wraps as well: bytes 5..9, then 10..13
+  span = rb->acquire_read();
+  EXPECT(span.len == 5 && span.data[0] == 5 && span.data[4] == 9);
+  rb->release_read(span.len);
+  span = rb->acquire_read();
+  EXPECT(span.len == 4 && span.data[0] == 10 && span.data[3] == 13);
+  rb->release_read(span.len);
+  EXPECT(rb->available() == 0);
+  EXPECT(rb->acquire_read().len == 0);
+}
+
+/// A span may be consumed in several parts, max_len limits it, and the copying read() continues where it stopped.
+static void test_zero_copy_partial_release() {
+  auto rb = RingBuffer::create(16);
+  const uint8_t in[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+  rb->write(in, sizeof(in));
+  auto span = rb->acquire_read(3);
+  EXPECT(span.len == 3 && span.data[0] == 0);
+  rb->release_read(1);
+  span = rb->acquire_read();
+  EXPECT(span.len == 7 && span.data[0] == 1);
+  rb->release_read(2);
+  uint8_t out[8];
+  EXPECT(rb->read(out, sizeof(out)) == 5 && out[0] == 3 && out[4] == 7);
+  // releasing more than is available only releases what is there
+  rb->write(in, 2);
+  rb->release_read(10);
+  EXPECT(rb->available() == 0);
+}
+
+/// Producer and consumer move random amounts through the spans, the consumer releasing only part of each span.
+static void test_zero_copy_threads() {
+  static const size_t TOTAL = 1 << 20;
+  auto rb = RingBuffer::create(257);
+  std::thread producer([&rb]() {
+    std::mt19937 rng(31);
+    size_t sent = 0;
+    while (sent < TOTAL) {
+      auto span = rb->acquire_write(std::min<size_t>(TOTAL - sent, 1 + rng() % 100));
+      if (span.len == 0) {
+        std::this_thread::yield();
+        continue;
+      }
+      for (size_t i = 0; i < span.len; i++)
+        span.data[i] = uint8_t((sent + i) * 7);
+      rb->commit_write(span.len);
+      sent += span.len;
+    }
+  });
+  std::mt19937 rng(37);
+  size_t received = 0;
+  bool in_order = true;
+  while (received < TOTAL) {
+    auto span = rb->acquire_read();
+    if (span.len == 0) {
+      std::this_thread::yield();
+      continue;
+    }
+    const size_t len = 1 + rng() % span.len;
+    for (size_t i = 0; i < len; i++)
+      in_order &= span.data[i] == uint8_t((received + i) * 7);
+    rb->release_read(len);
+    received += len;
+  }
+  producer.join();
+  EXPECT(in_order);
+  EXPECT(rb->available() == 0);
+}
+
+/// Throughput of a producer and a consumer thread, through the copying calls and through the spans.
+static void benchmark() {
+  static const size_t TOTAL = 64 << 20;
+  static const size_t CHUNK = 512;
+  auto mb_per_s = [](std::chrono::steady_clock::duration elapsed) {
+    return TOTAL / 1e6 / std::chrono::duration<double>(elapsed).count();
+  };
+  {
+    auto rb = RingBuffer::create(8192);
+    const auto start = std::chrono::steady_clock::now();
+    // without FreeRTOS the waiting calls poll once per millisecond, so spin instead to measure the copying itself
+    std::thread producer([&rb]() {
+      std::vector<uint8_t> chunk(CHUNK);
+      for (size_t sent = 0; sent < TOTAL;) {
+        const size_t len = rb->write_without_replacement(chunk.data(), CHUNK);
+        if (len == 0)
+          std::this_thread::yield();
+        sent += len;
+      }
+    });
+    std::vector<uint8_t> buffer(CHUNK);
+    for (size_t received = 0; received < TOTAL;) {
+      const size_t len = rb->read(buffer.data(), buffer.size());
+      if (len == 0)
+        std::this_thread::yield();
+      received += len;
+    }
+    producer.join();
+    printf("copy: %.0f MB/s\n", mb_per_s(std::chrono::steady_clock::now() - start));
+  }
+  {
+    auto rb = RingBuffer::create(8192);
+    const auto start = std::chrono::steady_clock::now();
+    std::thread producer([&rb]() {
+      for (size_t sent = 0; sent < TOTAL;) {
+        auto span = rb->acquire_write(CHUNK);
+        if (span.len == 0) {
+          std::this_thread::yield();
+          continue;
+        }
+        std::fill(span.data, span.data + span.len, 0);
+        rb->commit_write(span.len);
+        sent += span.len;
+      }
+    });
+    size_t sum = 0;
+    for (size_t received = 0; received < TOTAL;) {
+      auto span = rb->acquire_read(CHUNK);
+      if (span.len == 0) {
+        std::this_thread::yield();
+        continue;
+      }
+      sum += span.data[0];
+      rb->release_read(span.len);
+      received += span.len;
+    }
+    producer.join();
+    EXPECT(sum == 0);
+    printf("zero-copy: %.0f MB/s\n", mb_per_s(std::chrono::steady_clock::now() - start));
+  }
+}
+
+int main() {
+  test_partial_read();
+  test_write_timeout();
+  test_overwrite();
+  test_threads();
+  test_zero_copy_wraparound();
+  test_zero_copy_partial_release();
+  test_zero_copy_threads();
+  benchmark();
+  return test_result();
+}
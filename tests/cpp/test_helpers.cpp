@@ -0,0 +1,143 @@
+// Shared parts of the host C++ tests: the expectation counter and the Component methods, on top of a fake scheduler
+// instead of the application's, so neither the scheduler nor the application have to be linked.
+
+#include "test_helpers.h"
+
+#include "esphome/core/component.h"
+
+#include <cstdlib>
+
+int failures = 0;  // NOLINT
+FakeScheduler scheduler;  // NOLINT
+
+int test_result() {
+  if (failures != 0) {
+    printf("%d failures\n", failures);
+    return EXIT_FAILURE;
+  }
+  printf("OK\n");
+  return EXIT_SUCCESS;
+}
+
+void FakeScheduler::loop_once() {
+  // callbacks may add or cancel items, so work on a copy
+  auto items = this->items;
+  for (auto &it : items) {
+    if (this->items.count(it.first) == 0)
+      continue;
+    if (!it.second.repeat)
+      this->items.erase(it.first);
+    it.second.f();
+  }
+}
+
+bool FakeScheduler::run(esphome::Component *component, const std::string &name) {
+  auto it = this->items.find({component, name});
+  if (it == this->items.end())
+    return false;
+  auto f = it->second.f;
+  if (!it->second.repeat)
+    this->items.erase(it);
+  f();
+  return true;
+}
+
+size_t FakeScheduler::count(const std::string &name) const {
+  size_t n = 0;
+  for (auto &it : this->items)
+    n += it.first.second == name;
+  return n;
+}
+
+void FakeScheduler::add(esphome::Component *component, const std::string &name, bool repeat,
+                        std::function<void()> &&f) {
+  // unnamed items never replace each other
+  const std::string key = name.empty() ? "\x01" + std::to_string(this->anonymous_++) : name;
+  this->items[{component, key}] = {repeat, std::move(f)};
+}
+
+bool FakeScheduler::cancel(esphome::Component *component, const std::string &name) {
+  return this->items.erase({component, name}) != 0;
+}
+
+namespace esphome {
+
+namespace setup_priority {
+const float BUS = 1000.0f;
+const float IO = 900.0f;
+const float HARDWARE = 800.0f;
+const float DATA = 600.0f;
+const float PROCESSOR = 400.0;
+const float BLUETOOTH = 350.0f;
+const float AFTER_BLUETOOTH = 300.0f;
+const float WIFI = 250.0f;
+const float ETHERNET = 250.0f;
+const float BEFORE_CONNECTION = 220.0f;
+const float AFTER_WIFI = 200.0f;
+const float AFTER_CONNECTION = 100.0f;
+const float LATE = -100.0f;
+}  // namespace setup_priority
+
+const uint32_t COMPONENT_STATE_MASK = 0xFF;
+const uint32_t COMPONENT_STATE_FAILED = 0x03;
+const uint32_t STATUS_LED_WARNING = 0x0100;
+const uint32_t STATUS_LED_ERROR = 0x0200;
+
+float Component::get_loop_priority() const { return 0.0f; }
+float Component::get_setup_priority() const { return setup_priority::DATA; }
+void Component::setup() {}
+void Component::loop() {}
+void Component::dump_config() {}
+void Component::call_loop() { this->loop(); }
+void Component::call_setup() { this->setup(); }
+void Component::call_dump_config() { this->dump_config(); }
+bool Component::can_proceed() { return true; }
+void Component::mark_failed() {
+  this->component_state_ &= ~COMPONENT_STATE_MASK;
+  this->component_state_ |= COMPONENT_STATE_FAILED;
+  this->status_set_error();
+}
+bool Component::is_failed() const { return (this->component_state_ & COMPONENT_STATE_MASK) == COMPONENT_STATE_FAILED; }
+bool Component::status_has_warning() const { return this->component_state_ & STATUS_LED_WARNING; }
+bool Component::status_has_error() const { return this->component_state_ & STATUS_LED_ERROR; }
+void Component::status_set_warning(const char *message) { this->component_state_ |= STATUS_LED_WARNING; }
+void Component::status_set_error(const char *message) { this->component_state_ |= STATUS_LED_ERROR; }
+void Component::status_clear_warning() { this->component_state_ &= ~STATUS_LED_WARNING; }
+void Component::status_clear_error() { this->component_state_ &= ~STATUS_LED_ERROR; }
+const char *Component::get_component_source() const {
+  return this->component_source_ == nullptr ? "<unknown>" : this->component_source_;
+}
+
+void Component::set_interval(const std::string &name, uint32_t interval, std::function<void()> &&f) {  // NOLINT
+  scheduler.add(this, name, true, std::move(f));
+}
+void Component::set_interval(uint32_t interval, std::function<void()> &&f) {  // NOLINT
+  scheduler.add(this, "", true, std::move(f));
+}
+bool Component::cancel_interval(const std::string &name) { return scheduler.cancel(this, name); }  // NOLINT
+void Component::set_timeout(const std::string &name, uint32_t timeout, std::function<void()> &&f) {  // NOLINT
+  scheduler.add(this, name, false, std::move(f));
+}
+void Component::set_timeout(uint32_t timeout, std::function<void()> &&f) {  // NOLINT
+  scheduler.add(this, "", false, std::move(f));
+}
+bool Component::cancel_timeout(const std::string &name) { return scheduler.cancel(this, name); }  // NOLINT
+void Component::defer(const std::string &name, std::function<void()> &&f) {  // NOLINT
+  scheduler.add(this, name, false, std::move(f));
+}
+void Component::defer(std::function<void()> &&f) { scheduler.add(this, "", false, std::move(f)); }  // NOLINT
+bool Component::cancel_defer(const std::string &name) { return scheduler.cancel(this, name); }  // NOLINT
+
+PollingComponent::PollingComponent(uint32_t update_interval) : update_interval_(update_interval) {}
+void PollingComponent::call_setup() {
+  this->setup();
+  this->start_poller();
+}
+void PollingComponent::start_poller() {
+  this->set_interval("update", this->get_update_interval(), [this]() { this->update(); });
+}
+void PollingComponent::stop_poller() { this->cancel_interval("update"); }
+uint32_t PollingComponent::get_update_interval() const { return this->update_interval_; }
+void PollingComponent::set_update_interval(uint32_t update_interval) { this->update_interval_ = update_interval; }
+
+}  // namespace esphome
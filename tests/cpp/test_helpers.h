@@ -0,0 +1,58 @@
+#pragma once
+
+// Shared by the host C++ tests, linked into every test by script/cpp_tests together with test_helpers.cpp.
+
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <string>
+#include <utility>
+
+namespace esphome {
+class Component;
+}  // namespace esphome
+
+/// Number of failed expectations so far.
+extern int failures;  // NOLINT
+
+#define EXPECT(cond) \
+  do { \
+    if (!(cond)) { \
+      printf("%s:%d: expectation failed: %s\n", __FILE__, __LINE__, #cond); \
+      failures++; \
+    } \
+  } while (0)
+
+/// Prints the outcome of the test and returns the exit code for main().
+int test_result();
+
+/// Switches micros() and millis() of the test HAL (hal_stub.cpp) to a simulated time starting at @p now, for tests
+/// that must not depend on the load of the host. From then on time only passes in delay(), delayMicroseconds() and
+/// advance_time().
+void use_simulated_time(uint32_t now);
+/// Lets @p us of simulated time pass, e.g. for the duration of a simulated reading.
+void advance_time(uint32_t us);
+
+/// Replaces the application's scheduler for the Component timer methods. Nothing runs on its own: loop_once() runs
+/// every pending timer once regardless of its delay, like a loop iteration after all of them expired.
+struct FakeScheduler {
+  struct Item {
+    bool repeat;
+    std::function<void()> f;
+  };
+  std::map<std::pair<esphome::Component *, std::string>, Item> items;
+
+  /// Runs every item once; timeouts and deferred calls are removed before they run.
+  void loop_once();
+  /// Runs the item @p name of @p component once, returns false if there is none.
+  bool run(esphome::Component *component, const std::string &name);
+  /// Number of items called @p name over all components.
+  size_t count(const std::string &name) const;
+  void add(esphome::Component *component, const std::string &name, bool repeat, std::function<void()> &&f);
+  bool cancel(esphome::Component *component, const std::string &name);
+
+ protected:
+  uint32_t anonymous_{0};
+};
+extern FakeScheduler scheduler;  // NOLINT
@@ -0,0 +1,199 @@
+// sources: esphome/components/udp/udp_component.cpp esphome/components/sensor/sensor.cpp esphome/components/sensor/filter.cpp esphome/components/binary_sensor/binary_sensor.cpp esphome/components/binary_sensor/filter.cpp esphome/core/entity_base.cpp esphome/components/network/util.cpp esphome/components/socket/socket.cpp esphome/components/socket/bsd_sockets_impl.cpp esphome/core/helpers.cpp
+
+// Host test for the hashed ids of udp::UDPComponent.
+//
+// A sender and a receiver exchange sensor values over the loopback interface. Checks that changed values are sent
+// on their own and unchanged ones only with the full refresh of update(), that truncated entries for either hashed
+// key and entries with an unknown hash are not published, and that the entries before them are. Run with
+// script/cpp_tests.
+
+#include "esphome/components/udp/udp_component.h"
+#include "esphome/core/application.h"
+#include "test_helpers.h"
+
+#include <unistd.h>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace esphome {
+Application App;                               // NOLINT
+ESPPreferences *global_preferences = nullptr;  // NOLINT
+}  // namespace esphome
+
+using namespace esphome;
+using namespace esphome::udp;
+
+// As in udp_component.cpp
+static const uint16_t MAGIC_NUMBER = 0x4553;
+static const uint8_t DATA_KEY = 1;
+static const uint8_t SENSOR_HASH_KEY = 6;
+static const uint8_t BINARY_SENSOR_HASH_KEY = 7;
+
+/// The rolling code is neither enabled nor stored.
+class NullPreferences : public ESPPreferences {
+ public:
+  ESPPreferenceObject make_preference(size_t length, uint32_t type, bool in_flash) override { return {}; }
+  ESPPreferenceObject make_preference(size_t length, uint32_t type) override { return {}; }
+  bool sync() override { return true; }
+  bool reset() override { return true; }
+};
+
+class TestUDP : public UDPComponent {
+ public:
+  /// Sender and receiver share the application's name, the receiver needs its own to not ignore the sender.
+  void set_name(const char *name) { this->name_ = name; }
+  void process(std::vector<uint8_t> packet) { this->process_(packet.data(), packet.size()); }
+};
+
+/// A sensor that counts how often it was published.
+template<typename T> struct Counted {
+  Counted() {
+    this->sensor.add_on_state_callback([this](decltype(T().state) state) { this->count++; });
+  }
+  T sensor;
+  int count{0};
+};
+
+struct Fixture {
+  Fixture() {
+    App.pre_setup("sender", "", "", "", "", false);
+    global_preferences = &this->preferences;
+    const uint16_t port = 20000 + getpid() % 20000;
+
+    this->sender.add_sensor("temperature", &this->temperature);
+    this->sender.add_sensor("humidity", &this->humidity);
+    this->sender.add_binary_sensor("door", &this->door);
+    this->sender.add_address("127.0.0.1");
+    this->sender.set_port(port);
+    this->sender.set_hashed_ids(true);
+    this->sender.setup();
+
+    this->receiver.add_remote_sensor("sender", "temperature", &this->remote_temperature.sensor);
+    this->receiver.add_remote_sensor("sender", "humidity", &this->remote_humidity.sensor);
+    this->receiver.add_remote_binary_sensor("sender", "door", &this->remote_door.sensor);
+    this->receiver.set_port(port);
+    this->receiver.set_hashed_ids(true);
+    this->receiver.setup();
+    this->receiver.set_name("receiver");
+  }
+
+  /// Lets the sender send what is pending and the receiver process what arrived.
+  void exchange() {
+    this->sender.loop();
+    this->receiver.loop();
+  }
+
+  /// A packet from @p host with @p data after the header, @p data has to be a multiple of 4 bytes like the header.
+  static std::vector<uint8_t> packet(const char *host, const std::vector<uint8_t> &data) {
+    EXPECT(data.size() % 4 == 0);
+    std::vector<uint8_t> packet = {uint8_t(MAGIC_NUMBER), uint8_t(MAGIC_NUMBER >> 8), uint8_t(strlen(host))};
+    packet.insert(packet.end(), host, host + strlen(host));
+    while (packet.size() % 4 != 0)
+      packet.push_back(0);
+    packet.insert(packet.end(), data.begin(), data.end());
+    return packet;
+  }
+  static void add(std::vector<uint8_t> &data, uint32_t value) {
+    for (int i = 0; i < 4; i++)
+      data.push_back(uint8_t(value >> (8 * i)));
+  }
+  static uint32_t bits(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+  }
+
+  NullPreferences preferences;
+  sensor::Sensor temperature;
+  sensor::Sensor humidity;
+  binary_sensor::BinarySensor door;
+  TestUDP sender;
+  Counted<sensor::Sensor> remote_temperature;
+  Counted<sensor::Sensor> remote_humidity;
+  Counted<binary_sensor::BinarySensor> remote_door;
+  TestUDP receiver;
+};
+
+/// Between updates only changed sensor values are sent, update() sends all of them.
+static void test_changes_and_refresh() {
+  Fixture f;
+  EXPECT(!f.sender.is_failed() && !f.receiver.is_failed());
+  f.temperature.publish_state(21.5f);
+  f.humidity.publish_state(40.0f);
+  f.door.publish_state(true);
+  f.sender.update();
+  f.exchange();
+  EXPECT(f.remote_temperature.count == 1 && f.remote_temperature.sensor.state == 21.5f);
+  EXPECT(f.remote_humidity.count == 1 && f.remote_humidity.sensor.state == 40.0f);
+  EXPECT(f.remote_door.count == 1 && f.remote_door.sensor.state);
+
+  // only the changed value is sent
+  f.temperature.publish_state(22.0f);
+  f.exchange();
+  EXPECT(f.remote_temperature.count == 2 && f.remote_temperature.sensor.state == 22.0f);
+  EXPECT(f.remote_humidity.count == 1);
+
+  // publishing the same value again sends nothing
+  f.temperature.publish_state(22.0f);
+  f.exchange();
+  EXPECT(f.remote_temperature.count == 2);
+
+  // update() refreshes every sensor, changed or not
+  f.sender.update();
+  f.exchange();
+  EXPECT(f.remote_temperature.count == 3 && f.remote_temperature.sensor.state == 22.0f);
+  EXPECT(f.remote_humidity.count == 2 && f.remote_humidity.sensor.state == 40.0f);
+}
+
+/// An entry cut short by the end of the packet is dropped for either hashed key, the entries before it are kept.
+static void test_short_entries() {
+  Fixture f;
+  std::vector<uint8_t> data = {DATA_KEY, 0, 0, 0, BINARY_SENSOR_HASH_KEY};
+  Fixture::add(data, fnv1_hash("door"));
+  data.push_back(1);
+  // 5 of 8 bytes
+  data.push_back(SENSOR_HASH_KEY);
+  Fixture::add(data, fnv1_hash("temperature"));
+  data.push_back(0);
+  f.receiver.process(Fixture::packet("sender", data));
+  EXPECT(f.remote_door.count == 1 && f.remote_door.sensor.state);
+  EXPECT(f.remote_temperature.count == 0);
+
+  data = {DATA_KEY, 0, 0, SENSOR_HASH_KEY};
+  Fixture::add(data, fnv1_hash("temperature"));
+  Fixture::add(data, Fixture::bits(18.0f));
+  // 3 of 5 bytes
+  data.insert(data.end(), {BINARY_SENSOR_HASH_KEY, 0x11, 0x22, 0x33});
+  f.receiver.process(Fixture::packet("sender", data));
+  EXPECT(f.remote_temperature.count == 1 && f.remote_temperature.sensor.state == 18.0f);
+  EXPECT(f.remote_door.count == 1);
+}
+
+/// Entries with an unknown hash are skipped, also a known hash under the other key or from another host.
+static void test_unknown_hash() {
+  Fixture f;
+  std::vector<uint8_t> data = {DATA_KEY, 0, 0, 0, SENSOR_HASH_KEY};
+  Fixture::add(data, fnv1_hash("pressure"));
+  Fixture::add(data, Fixture::bits(1013.0f));
+  data.push_back(BINARY_SENSOR_HASH_KEY);
+  Fixture::add(data, fnv1_hash("humidity"));
+  data.push_back(1);
+  data.push_back(SENSOR_HASH_KEY);
+  Fixture::add(data, fnv1_hash("humidity"));
+  Fixture::add(data, Fixture::bits(55.0f));
+  f.receiver.process(Fixture::packet("sender", data));
+  EXPECT(f.remote_humidity.count == 1 && f.remote_humidity.sensor.state == 55.0f);
+  EXPECT(f.remote_temperature.count == 0 && f.remote_door.count == 0);
+
+  f.receiver.add_provider("other");
+  f.receiver.process(Fixture::packet("other", data));
+  EXPECT(f.remote_humidity.count == 1);
+}
+
+int main() {
+  test_changes_and_refresh();
+  test_short_entries();
+  test_unknown_hash();
+  return test_result();
+}
@@ -0,0 +1,130 @@
+// sources: esphome/components/voltage_sampler/voltage_sampler.cpp
+
+// Host test for VoltageSampler::sample_block().
+//
+// Samples a synthetic 50/60 Hz sine on a DC offset in blocks the way the CT clamp does, with time spent elsewhere
+// between the blocks, and checks the RMS of the AC part and the sample spacing. Also checks that a source slower
+// than the requested rate is cut off at the time limit and that failed readings are skipped. Runs on the simulated
+// time, every reading takes a fixed time. Run with script/cpp_tests.
+
+#include "esphome/components/voltage_sampler/voltage_sampler.h"
+#include "esphome/core/hal.h"
+#include "test_helpers.h"
+
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using namespace esphome;
+using namespace esphome::voltage_sampler;
+
+static const float OFFSET = 1.65f;
+static const float AMPLITUDE = 0.01f;
+static const uint32_t MAX_BLOCK_DURATION_US = 10000;
+
+/// A sine of @p frequency Hz on a DC offset, taking @p duration_us per reading. Records when each reading was
+/// taken.
+class SineSource : public VoltageSampler {
+ public:
+  SineSource(float frequency, uint32_t duration_us = 20) : frequency_(frequency), duration_us_(duration_us) {}
+
+  float sample() override {
+    const uint32_t now = micros();
+    this->times.push_back(now);
+    advance_time(this->duration_us_);
+    return OFFSET + AMPLITUDE * std::sin(2.0f * float(M_PI) * this->frequency_ * float(now % 1000000) / 1e6f);
+  }
+
+  std::vector<uint32_t> times;
+
+ protected:
+  float frequency_;
+  uint32_t duration_us_;
+};
+
+/// Every other reading fails.
+class FlakySource : public VoltageSampler {
+ public:
+  float sample() override { return this->calls_++ % 2 == 0 ? OFFSET : NAN; }
+
+ protected:
+  uint32_t calls_{0};
+};
+
+/// Blocks of 10 ms over the CT clamp's default 200 ms with 300 us spent elsewhere after each block: the RMS of the AC
+/// part matches the sine and the readings within a block follow the requested rate.
+static void test_sine(float frequency, uint32_t sample_rate) {
+  SineSource source(frequency);
+  const uint32_t interval = 1000000 / sample_rate;
+  const size_t block_size = sample_rate / 100;
+  std::vector<float> block(block_size);
+
+  float reference = 0.0f;
+  double sum = 0.0;
+  double squared_sum = 0.0;
+  uint32_t num_samples = 0;
+  uint32_t spacing_sum = 0;
+  uint32_t spacing_count = 0;
+  const uint32_t start = millis();
+  while (millis() - start < 200) {
+    const size_t first = source.times.size();
+    const size_t count = source.sample_block(block.data(), block_size, interval, MAX_BLOCK_DURATION_US);
+    for (size_t i = first + 1; i < source.times.size(); i++) {
+      spacing_sum += source.times[i] - source.times[i - 1];
+      spacing_count++;
+    }
+    if (num_samples == 0)
+      reference = block[0];
+    for (size_t i = 0; i < count; i++) {
+      const float value = block[i] - reference;
+      sum += value;
+      squared_sum += value * value;
+    }
+    num_samples += count;
+    delayMicroseconds(300);
+  }
+
+  const double mean = sum / num_samples;
+  const double rms = std::sqrt(squared_sum / num_samples - mean * mean);
+  const double expected = AMPLITUDE / std::sqrt(2.0);
+  const double average_spacing = double(spacing_sum) / spacing_count;
+  printf("%.0f Hz at %" PRIu32 " SPS: %" PRIu32 " samples, RMS error %.2f%%, average spacing %.1f us\n", frequency,
+         sample_rate, num_samples, 100.0 * (rms - expected) / expected, average_spacing);
+  EXPECT(std::fabs(rms - expected) < 0.02 * expected);
+  EXPECT(average_spacing == interval);
+}
+
+/// A reading that takes 1 ms at a requested 4 kHz: the block stops at the time limit instead of taking 64 ms.
+static void test_time_limit() {
+  SineSource source(50.0f, 1000);
+  float block[64];
+  const uint32_t start = micros();
+  const size_t count = source.sample_block(block, 64, 250, MAX_BLOCK_DURATION_US);
+  const uint32_t elapsed = micros() - start;
+  printf("slow source: %zu samples in %" PRIu32 " us\n", count, elapsed);
+  EXPECT(count == 10);
+  EXPECT(elapsed == MAX_BLOCK_DURATION_US);
+}
+
+/// Failed readings are skipped, the block still ends after the requested number of readings.
+static void test_failed_readings() {
+  FlakySource source;
+  float block[10];
+  EXPECT(source.sample_block(block, 10, 100, MAX_BLOCK_DURATION_US) == 5);
+  bool values_ok = true;
+  for (size_t i = 0; i < 5; i++)
+    values_ok &= block[i] == OFFSET;
+  EXPECT(values_ok);
+}
+
+int main() {
+  use_simulated_time(0);
+  for (float frequency : {50.0f, 60.0f}) {
+    for (uint32_t sample_rate : {1000, 4000})
+      test_sine(frequency, sample_rate);
+  }
+  test_time_limit();
+  test_failed_readings();
+  return test_result();
+}
@@ -0,0 +1,135 @@
+// sources: esphome/core/helpers.cpp
+
+// Host test for WaitUntilAction.
+//
+// Runs the action against the fake scheduler of test_helpers and counts how often its condition is evaluated over many loop
+// iterations: a condition that reports changes must only be checked after a change, a polled condition only while
+// an action is waiting. Run with script/cpp_tests.
+
+// base_automation.h expects millis() to be declared already, as it is in generated code
+#include "esphome/core/hal.h"
+
+#include "esphome/core/base_automation.h"
+#include "test_helpers.h"
+
+#include <functional>
+#include <vector>
+
+using namespace esphome;
+
+/// Condition on a flag that counts its evaluations and can report changes, like a binary sensor condition.
+class FlagCondition : public Condition<> {
+ public:
+  explicit FlagCondition(bool notifies) : notifies_(notifies) {}
+  bool check() override {
+    this->checks++;
+    return this->flag_;
+  }
+  bool add_on_change_callback(const std::function<void()> &callback) override {
+    if (!this->notifies_)
+      return false;
+    this->callbacks_.push_back(callback);
+    return true;
+  }
+  void set(bool flag) {
+    this->flag_ = flag;
+    for (auto &callback : this->callbacks_)
+      callback();
+  }
+
+  int checks{0};
+
+ protected:
+  bool notifies_;
+  bool flag_{false};
+  std::vector<std::function<void()>> callbacks_;
+};
+
+class CountAction : public Action<> {
+ public:
+  void play() override { this->plays++; }
+  int plays{0};
+};
+
+static const int IDLE_LOOPS = 1000;
+
+/// A condition that reports changes is not evaluated while nothing changes.
+static void test_event_driven() {
+  FlagCondition condition(true);
+  WaitUntilAction<> wait(&condition);
+  CountAction after;
+  ActionList<> actions;
+  actions.add_actions({&wait, &after});
+  wait.setup();
+
+  actions.play();
+  EXPECT(condition.checks == 1);
+  EXPECT(scheduler.items.empty());
+  for (int i = 0; i < IDLE_LOOPS; i++)
+    scheduler.loop_once();
+  EXPECT(condition.checks == 1);
+  EXPECT(after.plays == 0);
+
+  // the change is only acted on from the next loop iteration, not inside the state callback
+  condition.set(true);
+  EXPECT(after.plays == 0);
+  scheduler.loop_once();
+  EXPECT(after.plays == 1);
+  EXPECT(condition.checks == 2);
+
+  for (int i = 0; i < IDLE_LOOPS; i++)
+    scheduler.loop_once();
+  EXPECT(condition.checks == 2);
+  EXPECT(scheduler.items.empty());
+}
+
+/// Several waiters are released one per loop iteration after a single change.
+static void test_event_driven_several_waiters() {
+  FlagCondition condition(true);
+  WaitUntilAction<> wait(&condition);
+  CountAction after;
+  ActionList<> actions;
+  actions.add_actions({&wait, &after});
+  wait.setup();
+
+  for (int i = 0; i < 3; i++)
+    actions.play();
+  condition.set(true);
+  for (int i = 0; i < 10; i++)
+    scheduler.loop_once();
+  EXPECT(after.plays == 3);
+  EXPECT(scheduler.items.empty());
+}
+
+/// A condition that cannot report changes is polled once per loop iteration, but only while an action waits.
+static void test_polled() {
+  FlagCondition condition(false);
+  WaitUntilAction<> wait(&condition);
+  CountAction after;
+  ActionList<> actions;
+  actions.add_actions({&wait, &after});
+  wait.setup();
+
+  EXPECT(scheduler.items.empty());
+  actions.play();
+  EXPECT(scheduler.count("poll") == 1);
+  for (int i = 0; i < 10; i++)
+    scheduler.loop_once();
+  EXPECT(condition.checks == 11);
+
+  condition.set(true);
+  scheduler.loop_once();
+  EXPECT(after.plays == 1);
+  EXPECT(scheduler.items.empty());
+  const int checks = condition.checks;
+  for (int i = 0; i < IDLE_LOOPS; i++)
+    scheduler.loop_once();
+  EXPECT(condition.checks == checks);
+}
+
+int main() {
+  test_event_driven();
+  test_event_driven_several_waiters();
+  test_polled();
+  return test_result();
+}